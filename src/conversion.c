@@ -81,6 +81,23 @@ mzd_slice_t *mzed_slice(mzd_slice_t *A, const mzed_t *Z) {
   case 14: return _mzed_slice16(A,Z);
   case 15: return _mzed_slice16(A,Z);
   case 16: return _mzed_slice16(A,Z);
+
+  case 17: return _mzed_slice32(A,Z);
+  case 18: return _mzed_slice32(A,Z);
+  case 19: return _mzed_slice32(A,Z);
+  case 20: return _mzed_slice32(A,Z);
+  case 21: return _mzed_slice32(A,Z);
+  case 22: return _mzed_slice32(A,Z);
+  case 23: return _mzed_slice32(A,Z);
+  case 24: return _mzed_slice32(A,Z);
+  case 25: return _mzed_slice32(A,Z);
+  case 26: return _mzed_slice32(A,Z);
+  case 27: return _mzed_slice32(A,Z);
+  case 28: return _mzed_slice32(A,Z);
+  case 29: return _mzed_slice32(A,Z);
+  case 30: return _mzed_slice32(A,Z);
+  case 31: return _mzed_slice32(A,Z);
+  case 32: return _mzed_slice32(A,Z);
   default:
     m4ri_die("slicing not implemented for this degree");
   }
@@ -116,6 +133,23 @@ mzed_t *mzed_cling(mzed_t *A, const mzd_slice_t *Z) {
   case 14: return _mzed_cling16(A,Z);
   case 15: return _mzed_cling16(A,Z);
   case 16: return _mzed_cling16(A,Z);
+
+  case 17: return _mzed_cling32(A,Z);
+  case 18: return _mzed_cling32(A,Z);
+  case 19: return _mzed_cling32(A,Z);
+  case 20: return _mzed_cling32(A,Z);
+  case 21: return _mzed_cling32(A,Z);
+  case 22: return _mzed_cling32(A,Z);
+  case 23: return _mzed_cling32(A,Z);
+  case 24: return _mzed_cling32(A,Z);
+  case 25: return _mzed_cling32(A,Z);
+  case 26: return _mzed_cling32(A,Z);
+  case 27: return _mzed_cling32(A,Z);
+  case 28: return _mzed_cling32(A,Z);
+  case 29: return _mzed_cling32(A,Z);
+  case 30: return _mzed_cling32(A,Z);
+  case 31: return _mzed_cling32(A,Z);
+  case 32: return _mzed_cling32(A,Z);
   default:
     m4ri_die("clinging not implemented for this degree");
   }
@@ -419,3 +453,55 @@ mzed_t *_mzed_cling4(mzed_t *T, const mzd_slice_t *F) {
 }
 
 
+
+/**
+ * Elements of width 32 are only used for e > 16 where multiplication dominates, hence we
+ * simply collect bit k of both elements in each word.
+ */
+
+mzd_slice_t *_mzed_slice32(mzd_slice_t *T, const mzed_t *F) {
+  assert(T && (16 < T->depth && T->depth <= 32) && T->x[0]->offset == 0);
+
+  const word bitmask_end = __M4RI_LEFT_BITMASK((T->x[0]->offset + T->ncols) % m4ri_radix);
+  const wi_t width = F->x->width;
+
+  for(rci_t i=0; i<T->nrows; i++) {
+    const word *f = F->x->rows[i];
+    for(unsigned int k=0; k<T->depth; k++) {
+      word *t = T->x[k]->rows[i];
+      for(wi_t j=0, j2=0; j<width; j+=32, j2++) {
+        const wi_t n = MIN(32, width - j);
+        word r = 0;
+        for(wi_t h=0; h<n; h++) {
+          const word v = f[j+h]>>k;
+          r |= (v & 1)<<(2*h) | (v>>32 & 1)<<(2*h+1);
+        }
+        if (j2 == T->x[k]->width - 1)
+          r &= bitmask_end;
+        t[j2] |= r;
+      }
+    }
+  }
+  return T;
+}
+
+mzed_t *_mzed_cling32(mzed_t *T, const mzd_slice_t *F) {
+  assert(T && (16 < F->depth && F->depth <= 32) && T->x->offset == 0);
+
+  const wi_t width = T->x->width;
+
+  for(rci_t i=0; i<T->nrows; i++) {
+    word *t = T->x->rows[i];
+    for(wi_t j=0; j<width; j++) {
+      word r = 0;
+      for(unsigned int k=0; k<F->depth; k++) {
+        const word v = F->x[k]->rows[i][j/32]>>(2*(j%32));
+        r |= (v & 1)<<k | (v>>1 & 1)<<(32+k);
+      }
+      if (j == width - 1)
+        r &= T->x->high_bitmask;
+      t[j] |= r;
+    }
+  }
+  return T;
+}
@@ -94,6 +94,15 @@ mzd_slice_t *_mzed_slice8(mzd_slice_t *A, const mzed_t *Z);
 
 mzd_slice_t *_mzed_slice16(mzd_slice_t *A, const mzed_t *Z);
 
+/**
+ * \brief Unpack the matrix Z over \GF2E into bitslice representation for 16 < e <= 32.
+ *
+ * \param A Zero bitslice matrix over \GF2E
+ * \param Z Matrix over \GF2E
+ */
+
+mzd_slice_t *_mzed_slice32(mzd_slice_t *A, const mzed_t *Z);
+
 /**
  * \brief Pack a bitslice matrix into a classical represenation over GF(2^2).
  *
@@ -135,6 +144,15 @@ mzed_t *_mzed_cling8(mzed_t *A, const mzd_slice_t *Z);
 
 mzed_t *_mzed_cling16(mzed_t *A, const mzd_slice_t *Z);
 
+/**
+ * \brief Pack a bitslice matrix into a classical represenation over \GF2E for 16 < e <= 32.
+ *
+ * \param A Matrix over \GF2E, must be zero
+ * \param Z Bitslice matrix over \GF2E
+ */
+
+mzed_t *_mzed_cling32(mzed_t *A, const mzd_slice_t *Z);
+
 /**
  * \brief Compute C += A*B using Karatsuba multiplication of polynomials over GF(2).
  *
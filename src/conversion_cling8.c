@@ -18,6 +18,7 @@
 ******************************************************************************/
 
 #include "conversion.h"
+#include "dispatch.h"
 
 static inline word word_cling_64_08(word a) {
   a = (a & xf0f0f0f0 & x__left08) | (a & xf0f0f0f0>> 4  & x__left08)>>28;
@@ -26,6 +27,22 @@ static inline word word_cling_64_08(word a) {
   return a;
 }
 
+/**
+ * Pack all but the last block of eight words of row i using the vector kernel if there is one,
+ * return the number of words processed.
+ */
+
+static inline size_t _mzed_cling8_simd(mzed_t *T, const mzd_slice_t *F, const rci_t i, const m4rie_dispatch_t *d) {
+  if (d->cling8 == NULL || T->x->width <= 8)
+    return 0;
+  const wi_t n = (T->x->width - 1)/8;
+  const word *t[8];
+  for(unsigned int k=0; k<F->depth; k++)
+    t[k] = F->x[k]->rows[i];
+  d->cling8(T->x->rows[i], t, F->depth, n);
+  return 8*n;
+}
+
 mzed_t *_mzed_cling8(mzed_t *T, const mzd_slice_t *F) {
   size_t j,j2 = 0;
 
@@ -34,6 +51,8 @@ mzed_t *_mzed_cling8(mzed_t *T, const mzd_slice_t *F) {
   if (mzd_slice_is_zero(F))
     return T;
 
+  const m4rie_dispatch_t *d = m4rie_dispatch();
+
   switch (F->finite_field->degree) {
   case 8: {
     for(rci_t i=0; i<T->nrows; i++) {
@@ -47,7 +66,7 @@ mzed_t *_mzed_cling8(mzed_t *T, const mzd_slice_t *F) {
       const word *f7 = F->x[7]->rows[i];
       word *t  = T->x->rows[i];
 
-      for(j=0, j2=0; j+8 < T->x->width; j+=8, j2++) {
+      for(j=_mzed_cling8_simd(T, F, i, d), j2=j/8; j+8 < T->x->width; j+=8, j2++) {
         t[j+0] = (word_cling_64_08(f0[j2]<<56)>>7) | (word_cling_64_08(f1[j2]<<56)>>6) | (word_cling_64_08(f2[j2]<<56)>>5) | (word_cling_64_08(f3[j2]<<56)>>4) \
           |      (word_cling_64_08(f4[j2]<<56)>>3) | (word_cling_64_08(f5[j2]<<56)>>2) | (word_cling_64_08(f6[j2]<<56)>>1) | (word_cling_64_08(f7[j2]<<56)>>0);
         t[j+1] = (word_cling_64_08(f0[j2]<<48)>>7) | (word_cling_64_08(f1[j2]<<48)>>6) | (word_cling_64_08(f2[j2]<<48)>>5) | (word_cling_64_08(f3[j2]<<48)>>4) \
@@ -112,7 +131,7 @@ mzed_t *_mzed_cling8(mzed_t *T, const mzd_slice_t *F) {
       const word *f6 = F->x[6]->rows[i];
       word *t  = T->x->rows[i];
 
-      for(j=0, j2=0; j+8 < T->x->width; j+=8, j2++) {
+      for(j=_mzed_cling8_simd(T, F, i, d), j2=j/8; j+8 < T->x->width; j+=8, j2++) {
         t[j+0] = (word_cling_64_08(f0[j2]<<56)>>7) | (word_cling_64_08(f1[j2]<<56)>>6) | (word_cling_64_08(f2[j2]<<56)>>5) | (word_cling_64_08(f3[j2]<<56)>>4) \
           |      (word_cling_64_08(f4[j2]<<56)>>3) | (word_cling_64_08(f5[j2]<<56)>>2) | (word_cling_64_08(f6[j2]<<56)>>1);
         t[j+1] = (word_cling_64_08(f0[j2]<<48)>>7) | (word_cling_64_08(f1[j2]<<48)>>6) | (word_cling_64_08(f2[j2]<<48)>>5) | (word_cling_64_08(f3[j2]<<48)>>4) \
@@ -176,7 +195,7 @@ mzed_t *_mzed_cling8(mzed_t *T, const mzd_slice_t *F) {
       const word *f5 = F->x[5]->rows[i];
       word *t  = T->x->rows[i];
 
-      for(j=0, j2=0; j+8 < T->x->width; j+=8, j2++) {
+      for(j=_mzed_cling8_simd(T, F, i, d), j2=j/8; j+8 < T->x->width; j+=8, j2++) {
         t[j+0] = (word_cling_64_08(f0[j2]<<56)>>7) | (word_cling_64_08(f1[j2]<<56)>>6) | (word_cling_64_08(f2[j2]<<56)>>5) | (word_cling_64_08(f3[j2]<<56)>>4) \
           |      (word_cling_64_08(f4[j2]<<56)>>3) | (word_cling_64_08(f5[j2]<<56)>>2);
         t[j+1] = (word_cling_64_08(f0[j2]<<48)>>7) | (word_cling_64_08(f1[j2]<<48)>>6) | (word_cling_64_08(f2[j2]<<48)>>5) | (word_cling_64_08(f3[j2]<<48)>>4) \
@@ -239,7 +258,7 @@ mzed_t *_mzed_cling8(mzed_t *T, const mzd_slice_t *F) {
       const word *f4 = F->x[4]->rows[i];
       word *t  = T->x->rows[i];
 
-      for(j=0, j2=0; j+8 < T->x->width; j+=8, j2++) {
+      for(j=_mzed_cling8_simd(T, F, i, d), j2=j/8; j+8 < T->x->width; j+=8, j2++) {
         t[j+0] = (word_cling_64_08(f0[j2]<<56)>>7) | (word_cling_64_08(f1[j2]<<56)>>6) | (word_cling_64_08(f2[j2]<<56)>>5) | (word_cling_64_08(f3[j2]<<56)>>4) | (word_cling_64_08(f4[j2]<<56)>>3);
         t[j+1] = (word_cling_64_08(f0[j2]<<48)>>7) | (word_cling_64_08(f1[j2]<<48)>>6) | (word_cling_64_08(f2[j2]<<48)>>5) | (word_cling_64_08(f3[j2]<<48)>>4) | (word_cling_64_08(f4[j2]<<48)>>3);
         t[j+2] = (word_cling_64_08(f0[j2]<<40)>>7) | (word_cling_64_08(f1[j2]<<40)>>6) | (word_cling_64_08(f2[j2]<<40)>>5) | (word_cling_64_08(f3[j2]<<40)>>4) | (word_cling_64_08(f4[j2]<<40)>>3);
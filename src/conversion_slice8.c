@@ -18,6 +18,7 @@
 ******************************************************************************/
 
 #include "conversion.h"
+#include "dispatch.h"
 
 static inline word word_slice_64_08(word a) {
   a = (a & xff00ff00) | (a & xff00ff00>> 8)<< 7;
@@ -26,6 +27,22 @@ static inline word word_slice_64_08(word a) {
   return a;
 }
 
+/**
+ * Slice all but the last block of eight words of row i using the vector kernel if there is one,
+ * return the number of words processed.
+ */
+
+static inline size_t _mzed_slice8_simd(mzd_slice_t *T, const mzed_t *F, const size_t i, const m4rie_dispatch_t *d) {
+  if (d->slice8 == NULL || F->x->width <= 8)
+    return 0;
+  const wi_t n = (F->x->width - 1)/8;
+  word *t[8];
+  for(unsigned int k=0; k<T->depth; k++)
+    t[k] = T->x[k]->rows[i];
+  d->slice8(t, T->depth, F->x->rows[i], n);
+  return 8*n;
+}
+
 mzd_slice_t *_mzed_slice8(mzd_slice_t *T, const mzed_t *F) {
   assert(T && (4 < T->depth && T->depth <= 8) && T->x[0]->offset == 0);
   size_t j, j2 = 0;
@@ -36,6 +53,8 @@ mzd_slice_t *_mzed_slice8(mzd_slice_t *T, const mzed_t *F) {
   if (mzed_is_zero(F))
     return T;
 
+  const m4rie_dispatch_t *d = m4rie_dispatch();
+
   switch(T->depth) {
   case 8: {
       for(size_t i=0; i<T->nrows; i++) {
@@ -50,7 +69,7 @@ mzd_slice_t *_mzed_slice8(mzd_slice_t *T, const mzed_t *F) {
         const word const *f  = F->x->rows[i];
 
         /* bulk of work */
-        for(j=0, j2=0; j+8 < F->x->width; j+=8,j2++) {
+        for(j=_mzed_slice8_simd(T, F, i, d), j2=j/8; j+8 < F->x->width; j+=8,j2++) {
           t0[j2] |= word_slice_64_08(f[j+0]<<7 & x80808080)>>56 | word_slice_64_08(f[j+1]<<7 & x80808080)>>48 \
             |       word_slice_64_08(f[j+2]<<7 & x80808080)>>40 | word_slice_64_08(f[j+3]<<7 & x80808080)>>32 \
             |       word_slice_64_08(f[j+4]<<7 & x80808080)>>24 | word_slice_64_08(f[j+5]<<7 & x80808080)>>16 \
@@ -193,7 +212,7 @@ mzd_slice_t *_mzed_slice8(mzd_slice_t *T, const mzed_t *F) {
         const word const *f  = F->x->rows[i];
 
         /* bulk of work */
-        for(j=0, j2=0; j+8 < F->x->width; j+=8,j2++) {
+        for(j=_mzed_slice8_simd(T, F, i, d), j2=j/8; j+8 < F->x->width; j+=8,j2++) {
           t0[j2] |= word_slice_64_08(f[j+0]<<7 & x80808080)>>56 | word_slice_64_08(f[j+1]<<7 & x80808080)>>48 \
             |       word_slice_64_08(f[j+2]<<7 & x80808080)>>40 | word_slice_64_08(f[j+3]<<7 & x80808080)>>32 \
             |       word_slice_64_08(f[j+4]<<7 & x80808080)>>24 | word_slice_64_08(f[j+5]<<7 & x80808080)>>16 \
@@ -321,7 +340,7 @@ mzd_slice_t *_mzed_slice8(mzd_slice_t *T, const mzed_t *F) {
         const word const *f  = F->x->rows[i];
 
         /* bulk of work */
-        for(j=0, j2=0; j+8 < F->x->width; j+=8,j2++) {
+        for(j=_mzed_slice8_simd(T, F, i, d), j2=j/8; j+8 < F->x->width; j+=8,j2++) {
           t0[j2] |= word_slice_64_08(f[j+0]<<7 & x80808080)>>56 | word_slice_64_08(f[j+1]<<7 & x80808080)>>48 \
             |       word_slice_64_08(f[j+2]<<7 & x80808080)>>40 | word_slice_64_08(f[j+3]<<7 & x80808080)>>32 \
             |       word_slice_64_08(f[j+4]<<7 & x80808080)>>24 | word_slice_64_08(f[j+5]<<7 & x80808080)>>16 \
@@ -434,7 +453,7 @@ mzd_slice_t *_mzed_slice8(mzd_slice_t *T, const mzed_t *F) {
         const word const *f  = F->x->rows[i];
 
         /* bulk of work */
-        for(j=0, j2=0; j+8 < F->x->width; j+=8,j2++) {
+        for(j=_mzed_slice8_simd(T, F, i, d), j2=j/8; j+8 < F->x->width; j+=8,j2++) {
           t0[j2] |= word_slice_64_08(f[j+0]<<7 & x80808080)>>56 | word_slice_64_08(f[j+1]<<7 & x80808080)>>48 \
             |       word_slice_64_08(f[j+2]<<7 & x80808080)>>40 | word_slice_64_08(f[j+3]<<7 & x80808080)>>32 \
             |       word_slice_64_08(f[j+4]<<7 & x80808080)>>24 | word_slice_64_08(f[j+5]<<7 & x80808080)>>16 \
@@ -0,0 +1,183 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include "config.h"
+#include <stdio.h>
+#include "dispatch.h"
+
+/**
+ * Whatever M4RI was compiled with.
+ */
+
+static void _m4rie_combine4_m4ri(word *c, const word *t0, const word *t1, const word *t2, const word *t3, const wi_t n) {
+  _mzd_combine4(c, t0, t1, t2, t3, n);
+}
+
+static void _m4rie_combine8_m4ri(word *c, const word *t0, const word *t1, const word *t2, const word *t3,
+                                 const word *t4, const word *t5, const word *t6, const word *t7, const wi_t n) {
+  _mzd_combine8(c, t0, t1, t2, t3, t4, t5, t6, t7, n);
+}
+
+/**
+ * The kernels are selected on first use, possibly by several threads at once. Flags which are
+ * read without a lock are published with release and read with acquire semantics, such that a
+ * thread which sees the flag also sees the data it guards.
+ */
+
+#if defined(__GNUC__)
+#define __M4RIE_LOAD_ACQUIRE(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define __M4RIE_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+#define __M4RIE_LOAD_ACQUIRE(p) (*(volatile int*)(p))
+#define __M4RIE_STORE_RELEASE(p, v) (*(volatile int*)(p) = (v))
+#endif
+
+static m4rie_dispatch_t _m4rie_dispatch;
+static int _m4rie_dispatch_initialized = 0;
+
+int m4rie_cpu_features(void) {
+  static int features = -1;
+  int cached = __M4RIE_LOAD_ACQUIRE(&features);
+  if (cached < 0) {
+    int f = 0;
+#ifdef __M4RIE_HAVE_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2"))
+      f |= M4RIE_CPU_SSE2;
+    if (__builtin_cpu_supports("ssse3"))
+      f |= M4RIE_CPU_SSSE3;
+    if (__builtin_cpu_supports("avx2"))
+      f |= M4RIE_CPU_AVX2;
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+      f |= M4RIE_CPU_AVX512;
+    if (__builtin_cpu_supports("gfni"))
+      f |= M4RIE_CPU_GFNI;
+    if (__builtin_cpu_supports("pclmul"))
+      f |= M4RIE_CPU_CLMUL;
+#endif
+    /** every thread computes the same value **/
+    __M4RIE_STORE_RELEASE(&features, f);
+    cached = f;
+  }
+  return cached;
+}
+
+/**
+ * Store the kernels for the given features in dp.
+ */
+
+static void _m4rie_dispatch_select(m4rie_dispatch_t *dp, int features) {
+  m4rie_dispatch_t d;
+  features &= m4rie_cpu_features();
+
+  d.features = features;
+  d.mul8  = _gf2e_simd_mul_generic_row;  d.mul8_name  = "generic";
+  d.mul16 = _gf2e_simd_mul_generic_row;  d.mul16_name = "generic";
+  d.mul8_rows  = _gf2e_simd_mul_rows_generic;
+  d.mul16_rows = _gf2e_simd_mul_rows_generic;
+  d.combine4 = _m4rie_combine4_m4ri;
+  d.combine8 = _m4rie_combine8_m4ri;     d.combine_name = "m4ri";
+  d.slice8 = NULL;                       d.slice8_name = "generic";
+  d.cling8 = NULL;                       d.cling8_name = "generic";
+
+#ifdef __M4RIE_HAVE_X86_SIMD
+  if (features & M4RIE_CPU_SSE2) {
+    d.combine4 = _gf2e_simd_combine4_sse2;
+    d.combine8 = _gf2e_simd_combine8_sse2;  d.combine_name = "sse2";
+    d.slice8 = _gf2e_simd_slice8_sse2;      d.slice8_name = "sse2";
+  }
+  if (features & M4RIE_CPU_SSSE3) {
+    d.mul8  = _gf2e_simd_mul_ssse3_row;     d.mul8_name  = "ssse3";
+    d.mul16 = _gf2e_simd_mul_ssse3_row;     d.mul16_name = "ssse3";
+    d.mul8_rows  = _gf2e_simd_mul_rows_ssse3;
+    d.mul16_rows = _gf2e_simd_mul_rows_ssse3;
+  }
+  if ((features & M4RIE_CPU_AVX2) && (features & M4RIE_CPU_SSSE3)) {
+    d.mul8  = _gf2e_simd_mul_avx2_row;      d.mul8_name  = "avx2";
+    d.mul16 = _gf2e_simd_mul_avx2_row;      d.mul16_name = "avx2";
+    d.mul8_rows  = _gf2e_simd_mul_rows_avx2;
+    d.mul16_rows = _gf2e_simd_mul_rows_avx2;
+    d.combine4 = _gf2e_simd_combine4_avx2;
+    d.combine8 = _gf2e_simd_combine8_avx2;  d.combine_name = "avx2";
+    d.slice8 = _gf2e_simd_slice8_avx2;      d.slice8_name = "avx2";
+    d.cling8 = _gf2e_simd_cling8_avx2;      d.cling8_name = "avx2";
+    if (features & M4RIE_CPU_GFNI) {
+      d.mul8 = _gf2e_simd_mul_gfni_row;     d.mul8_name  = "gfni+avx2";
+      d.mul8_rows = _gf2e_simd_mul_rows_gfni;
+    }
+  }
+  if (features & M4RIE_CPU_AVX512) {
+    d.combine4 = _gf2e_simd_combine4_avx512;
+    d.combine8 = _gf2e_simd_combine8_avx512; d.combine_name = "avx512";
+    d.slice8 = _gf2e_simd_slice8_avx512;     d.slice8_name = "avx512";
+    d.cling8 = _gf2e_simd_cling8_avx512;     d.cling8_name = "avx512";
+    if ((features & M4RIE_CPU_GFNI) && (features & M4RIE_CPU_AVX2) && (features & M4RIE_CPU_SSSE3)) {
+      d.mul8 = _gf2e_simd_mul_gfni_avx512_row; d.mul8_name = "gfni+avx512";
+      d.mul8_rows = _gf2e_simd_mul_rows_gfni_avx512;
+    }
+  }
+#endif //__M4RIE_HAVE_X86_SIMD
+
+  *dp = d;
+}
+
+void m4rie_dispatch_init(int features) {
+  m4rie_dispatch_t d;
+  _m4rie_dispatch_select(&d, features);
+
+#ifdef HAVE_OPENMP
+#pragma omp critical (m4rie_dispatch)
+#endif
+  {
+    _m4rie_dispatch = d;
+    __M4RIE_STORE_RELEASE(&_m4rie_dispatch_initialized, 1);
+  }
+}
+
+const m4rie_dispatch_t *m4rie_dispatch(void) {
+  if (!__M4RIE_LOAD_ACQUIRE(&_m4rie_dispatch_initialized)) {
+#ifdef HAVE_OPENMP
+#pragma omp critical (m4rie_dispatch)
+#endif
+    {
+      /** only the first thread to get here selects the kernels **/
+      if (!_m4rie_dispatch_initialized) {
+        _m4rie_dispatch_select(&_m4rie_dispatch, m4rie_cpu_features());
+        __M4RIE_STORE_RELEASE(&_m4rie_dispatch_initialized, 1);
+      }
+    }
+  }
+  return &_m4rie_dispatch;
+}
+
+void m4rie_dispatch_print(void) {
+  const m4rie_dispatch_t *d = m4rie_dispatch();
+  printf("features:%s%s%s%s%s%s\n",
+         (d->features & M4RIE_CPU_SSE2)   ? " sse2"   : "",
+         (d->features & M4RIE_CPU_SSSE3)  ? " ssse3"  : "",
+         (d->features & M4RIE_CPU_AVX2)   ? " avx2"   : "",
+         (d->features & M4RIE_CPU_AVX512) ? " avx512" : "",
+         (d->features & M4RIE_CPU_GFNI)   ? " gfni"   : "",
+         (d->features & M4RIE_CPU_CLMUL)  ? " clmul"  : "");
+  printf("mul8:     %s\n", d->mul8_name);
+  printf("mul16:    %s\n", d->mul16_name);
+  printf("combine:  %s\n", d->combine_name);
+  printf("slice8:   %s\n", d->slice8_name);
+  printf("cling8:   %s\n", d->cling8_name);
+}
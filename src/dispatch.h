@@ -0,0 +1,113 @@
+/**
+ * \file dispatch.h
+ *
+ * \brief Runtime selection of vectorised kernels.
+ *
+ * The hot row kernels exist in several variants compiled for different instruction sets. The CPU
+ * is queried once and the widest variant it supports is used, so a single build runs at full
+ * vector width on every x86-64 machine regardless of the compiler flags used.
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+#ifndef M4RIE_DISPATCH_H
+#define M4RIE_DISPATCH_H
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <m4ri/m4ri.h>
+#include <m4rie/gf2e_simd.h>
+
+/**
+ * \brief CPU features used by the kernels.
+ */
+
+#define M4RIE_CPU_SSE2    0x01 /**< SSE2 */
+#define M4RIE_CPU_SSSE3   0x02 /**< SSSE3, i.e. PSHUFB */
+#define M4RIE_CPU_AVX2    0x04 /**< AVX2 */
+#define M4RIE_CPU_AVX512  0x08 /**< AVX-512F and AVX-512BW */
+#define M4RIE_CPU_GFNI    0x10 /**< GF2P8AFFINEQB, only used together with AVX2 or AVX-512 */
+#define M4RIE_CPU_CLMUL   0x20 /**< PCLMULQDQ */
+
+/**
+ * \brief Kernels selected for the running CPU.
+ *
+ * Entries which are NULL have no vectorised variant and callers use their scalar code.
+ */
+
+typedef struct {
+  int features; /**< features the kernels were selected for */
+
+  /** t = x*f or t += x*f for w <= 8, see _gf2e_simd_mul() */
+  void (*mul8)(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add);
+  /** t = x*f or t += x*f for w = 16, see _gf2e_simd_mul() */
+  void (*mul16)(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add);
+  /** t += x_0*f_0 + ... + x_{k-1}*f_{k-1} for w <= 8, see _gf2e_simd_mul_rows() */
+  void (*mul8_rows)(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n);
+  /** t += x_0*f_0 + ... + x_{k-1}*f_{k-1} for w = 16, see _gf2e_simd_mul_rows() */
+  void (*mul16_rows)(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n);
+  /** c += t0 + ... + t3 */
+  void (*combine4)(word *c, const word *t0, const word *t1, const word *t2, const word *t3, const wi_t n);
+  /** c += t0 + ... + t7 */
+  void (*combine8)(word *c, const word *t0, const word *t1, const word *t2, const word *t3,
+                   const word *t4, const word *t5, const word *t6, const word *t7, const wi_t n);
+  /** bitslice 8n bytes, see _mzed_slice8() */
+  void (*slice8)(word *const *t, const unsigned int depth, const word *f, const wi_t n);
+  /** pack 8n bytes, see _mzed_cling8() */
+  void (*cling8)(word *f, const word *const *t, const unsigned int depth, const wi_t n);
+
+  const char *mul8_name;     /**< name of the mul8 and mul8_rows variant */
+  const char *mul16_name;    /**< name of the mul16 and mul16_rows variant */
+  const char *combine_name;  /**< name of the combine4/combine8 variant */
+  const char *slice8_name;   /**< name of the slice8 variant */
+  const char *cling8_name;   /**< name of the cling8 variant */
+} m4rie_dispatch_t;
+
+/**
+ * \brief Return the features of the CPU we are running on.
+ */
+
+int m4rie_cpu_features(void);
+
+/**
+ * \brief Select kernels using only the given features.
+ *
+ * Features the CPU does not support are ignored. This is called automatically with
+ * m4rie_cpu_features() on first use, calling it again allows to restrict the kernels used, e.g.
+ * for testing or benchmarking. Do not call it while other threads use the library.
+ *
+ * \param features Bitmask of M4RIE_CPU_* values.
+ */
+
+void m4rie_dispatch_init(int features);
+
+/**
+ * \brief Return the kernels in use.
+ */
+
+const m4rie_dispatch_t *m4rie_dispatch(void);
+
+/**
+ * \brief Print the features and kernels in use to stdout.
+ */
+
+void m4rie_dispatch_print(void);
+
+#endif //M4RIE_DISPATCH_H
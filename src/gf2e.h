@@ -31,7 +31,28 @@
 #include <m4ri/m4ri.h>
 #include <m4rie/gf2x.h>
 
-#define M4RIE_MAX_DEGREE 16
+#define M4RIE_MAX_DEGREE 32
+
+/**
+ * \brief Largest degree for which tables with \f$2^e\f$ entries, e.g. gf2e::red, gf2e::_inv or
+ * Newton-John tables, are built.
+ *
+ * Larger fields use table-free arithmetic only.
+ */
+
+#define M4RIE_MAX_TABLE_DEGREE 16
+
+/**
+ * \brief Implementation used for arithmetic in \GF2E.
+ */
+
+typedef enum {
+  GF2E_MODE_AUTO = 0, /**< pick the fastest implementation available for the degree and CPU. */
+  GF2E_MODE_TABLE,    /**< full multiplication table, only for \e <= 8. */
+  GF2E_MODE_ARITH,    /**< gf2x_mul() followed by a lookup in red. */
+  GF2E_MODE_CLMUL,    /**< carry-less multiplication, only if the CPU supports PCLMULQDQ. */
+  GF2E_MODE_LOGEXP,   /**< discrete logarithm and antilogarithm tables. */
+} gf2e_mode;
 
 /**
  * \brief \GF2E
@@ -44,8 +65,13 @@ struct gf2e_struct {
   word minpoly;   /**<  Irreducible polynomial of degree \e. */
 
   word *pow_gen; /**< pow_gen[i] holds \f$a^i / <f>\f$ for \f$a\f$ a generator of this field.  */
-  word *red;     /**< red[i] holds precomputed reductors for the minpoly. \f$\f$. */
+  word *red;     /**< red[i] holds precomputed reductors for the minpoly or NULL if \e > M4RIE_MAX_TABLE_DEGREE. */
   word **_mul;   /**< mul[a][b] holds \f$ a \cdot b\f for small fields$. */
+  word _barrett; /**< \f$\lfloor X^{2e} / minpoly \rfloor\f$ used for Barrett reduction. */
+  word *_inv;    /**< _inv[a] holds \f$a^{-1}\f$ for \f$a \neq 0\f$ and _inv[0] = 0 or NULL if \e > M4RIE_MAX_TABLE_DEGREE. */
+  word *_log;    /**< _log[a] holds i such that \f$g^i = a\f$ for a fixed primitive element \f$g\f$ or NULL. */
+  word *_exp;    /**< _exp[i] holds \f$g^i\f$ for \f$0 \leq i < 2 \cdot 2^e\f$ or NULL. */
+  gf2e_mode mode; /**< Implementation used by mul and inv. */
 
   word (*inv)(const gf2e *ff, const word a); /**< implements a^(-1) for a in \GF2E */
   word (*mul)(const gf2e *ff, const word a, const word b); /**< implements a*b for a in \GF2E */
@@ -59,6 +85,15 @@ struct gf2e_struct {
 
 gf2e *gf2e_init(const word minpoly);
 
+/**
+ * Create finite field from minimal polynomial using a given implementation.
+ *
+ * \param minpoly Polynomial represented as series of bits.
+ * \param mode Implementation of arithmetic, GF2E_MODE_AUTO picks the fastest.
+ */
+
+gf2e *gf2e_init_mode(const word minpoly, gf2e_mode mode);
+
 /**
  * Free ff
  *
@@ -67,11 +102,73 @@ gf2e *gf2e_init(const word minpoly);
 
 void gf2e_free(gf2e *ff);
 
+/**
+ * Number of functions which can be registered with gf2e_on_free().
+ */
+
+#define M4RIE_FREE_HOOKS 8
+
+/**
+ * \brief Register a function which gf2e_free() calls with every field before freeing it.
+ *
+ * Caches of objects over a field use this to drop them. Registering the same function again has no
+ * effect.
+ *
+ * \param hook Function, may be called from any thread.
+ */
+
+void gf2e_on_free(void (*hook)(const gf2e *ff));
+
+/**
+ * \brief Return the shared field for minpoly.
+ *
+ * The field is created with gf2e_init() on first use and shared by all callers afterwards, it
+ * must not be modified. Every call must be matched by a call to gf2e_release().
+ *
+ * \param minpoly Polynomial represented as series of bits.
+ */
+
+const gf2e *gf2e_get(const word minpoly);
+
+/**
+ * \brief Release a field obtained from gf2e_get().
+ *
+ * The field stays in the registry so that the next gf2e_get() is free, see gf2e_registry_clear().
+ *
+ * \param ff Finite field.
+ */
+
+void gf2e_release(const gf2e *ff);
+
+/**
+ * \brief Free all fields in the registry which are not referenced anymore.
+ */
+
+void gf2e_registry_clear(void);
+
 /**
  * \brief a^(-1) % minpoly
  */
 
 static inline word gf2e_inv(const gf2e *ff, word a) {
+  if (ff->_inv != NULL)
+    return ff->_inv[a];
+  return ff->inv(ff, a);
+}
+
+/**
+ * \brief a^(-1) % minpoly using a table lookup.
+ */
+
+static inline word _gf2e_inv_table(const gf2e *ff, const word a) {
+  return ff->_inv[a];
+}
+
+/**
+ * \brief a^(-1) % minpoly using the extended Euclidean algorithm.
+ */
+
+static inline word _gf2e_inv_arith(const gf2e *ff, const word a) {
   return gf2x_invmod(a, ff->minpoly, ff->degree);
 }
 
@@ -83,15 +180,70 @@ static inline word _gf2e_mul_table(const gf2e *ff, const word a, const word b) {
   return ff->_mul[a][b];
 }
 
+/**
+ * \brief a % minpoly for deg(a) <= 2e-2.
+ *
+ * Uses one lookup in gf2e::red if available and one addition of gf2e::pow_gen per bit of a
+ * above the degree otherwise.
+ */
+
+static inline word _gf2e_reduce(const gf2e *ff, const word a) {
+  if (ff->red != NULL)
+    return a ^ ff->red[a>>ff->degree];
+  word res = a & __M4RI_LEFT_BITMASK(ff->degree);
+  unsigned int i = ff->degree;
+  for(word h = a>>ff->degree; h; h >>= 1, i++)
+    if (h & 1)
+      res ^= ff->pow_gen[i];
+  return res;
+}
+
 /**
  * \brief a*b in \GF2E using a gf2x_mul() lookups.
  */
 
 static inline word _gf2e_mul_arith(const gf2e *ff, const word a, const word b) {
-  const word res = gf2x_mul(a, b, ff->degree);
-  return res ^ ff->red[res>>ff->degree];
+  return _gf2e_reduce(ff, gf2x_mul(a, b, ff->degree));
+}
+
+/**
+ * \brief a*b in \GF2E using two logarithm and one antilogarithm lookup.
+ */
+
+static inline word _gf2e_mul_logexp(const gf2e *ff, const word a, const word b) {
+  if (a == 0 || b == 0)
+    return 0;
+  return ff->_exp[ff->_log[a] + ff->_log[b]];
 }
 
+/**
+ * \brief a^n in \GF2E for n >= 0.
+ */
+
+static inline word gf2e_pow(const gf2e *ff, word a, word n) {
+  if (ff->_log != NULL) {
+    if (a == 0)
+      return (n == 0);
+    return ff->_exp[(ff->_log[a] * (n % (__M4RI_TWOPOW(ff->degree) - 1))) % (__M4RI_TWOPOW(ff->degree) - 1)];
+  }
+  word res = 1;
+  while(n) {
+    if (n & 1)
+      res = ff->mul(ff, res, a);
+    a = ff->mul(ff, a, a);
+    n >>= 1;
+  }
+  return res;
+}
+
+/**
+ * \brief a*b in \GF2E using carry-less multiplication and Barrett reduction.
+ *
+ * \warning Only call this function if the CPU supports PCLMULQDQ, gf2e_init() takes care of this.
+ */
+
+word _gf2e_mul_clmul(const gf2e *ff, const word a, const word b);
+
 /**
  * \brief a*b in \GF2E.
  */
@@ -100,9 +252,41 @@ static inline word gf2e_mul(const gf2e *ff, const word a, const word b) {
   if( ff->_mul != NULL )
     return _gf2e_mul_table(ff, a, b);
   else
-    return _gf2e_mul_arith(ff, a, b);
+    return ff->mul(ff, a, b);
 }
 
+/**
+ * \brief c[i] = a[i]*b[i] for 0 <= i < n.
+ *
+ * \param ff Finite field.
+ * \param c Output vector, may be a or b.
+ * \param a Input vector.
+ * \param b Input vector.
+ * \param n Length of the vectors.
+ */
+
+void gf2e_mul_vec(const gf2e *ff, word *c, const word *a, const word *b, const size_t n);
+
+/**
+ * \brief out[i] = in[i]^(-1) for 0 <= i < n and out[i] = 0 if in[i] = 0.
+ *
+ * Uses the inverse table if ff has one and Montgomery's trick, i.e. one inversion and 3(n-1)
+ * multiplications, otherwise.
+ *
+ * \param ff Finite field.
+ * \param out Output vector, may be in.
+ * \param in Input vector.
+ * \param n Length of the vectors.
+ */
+
+void gf2e_inv_batch(const gf2e *ff, word *out, const word *in, const size_t n);
+
+/**
+ * \brief gf2e_inv_batch() using Montgomery's trick unconditionally.
+ */
+
+void _gf2e_inv_batch_montgomery(const gf2e *ff, word *out, const word *in, const size_t n);
+
 /**
  * Return the width used for storing elements of ff
  *
@@ -130,16 +314,49 @@ static inline size_t gf2e_degree_to_w(const gf2e *ff) {
   case 15:
   case 16:
     return 16;
+  case 17:
+  case 18:
+  case 19:
+  case 20:
+  case 21:
+  case 22:
+  case 23:
+  case 24:
+  case 25:
+  case 26:
+  case 27:
+  case 28:
+  case 29:
+  case 30:
+  case 31:
+  case 32:
+    return 32;
   default:
     m4ri_die("degree %d not supported.\n",ff->degree);
   }
   return 0;
 }
 
+/**
+ * Fill mul with all 2^k sums of basis[0], ..., basis[k-1], i.e. mul[i] is the sum of basis[j] for
+ * all bits j set in i. The entries are visited in Gray code order such that each entry costs one
+ * XOR.
+ */
+
+static inline void _gf2e_span_gray(word *mul, const word *basis, const int k) {
+  const code *gc = m4ri_codebook[k];
+  mul[0] = 0;
+  for(word i=1; i<__M4RI_TWOPOW(k); i++)
+    mul[gc->ord[i]] = mul[gc->ord[i-1]] ^ basis[gc->inc[i-1]];
+}
+
 /**
  * Compute all multiples by a of vectors fitting into 16 bits.
  *
- * \param ff Finite field.
+ * Multiplication by a is \GF2-linear, hence the table is spanned by the images of the 16 unit
+ * vectors.
+ *
+ * \param ff Finite field with e <= 16.
  * \param a Finite field element.
  */
 
@@ -147,28 +364,13 @@ static inline word *gf2e_t16_init(const gf2e *ff, const word a) {
   word *mul = (word*)m4ri_mm_calloc(1<<16, sizeof(word));
 
   const unsigned int w = gf2e_degree_to_w(ff);
-  const word mask_w = (1<<w)-1;
-
-  /**
-   * @todo: this is a bit of overkill, we could do better
-   */
-  for(word i=0; i<1<<16; i++) {
-    switch(w) {
-    case 2:
-      mul[i]  = gf2e_mul(ff, a, ((i>>0)&mask_w))<<0 | gf2e_mul(ff, a, ((i>> 2)&mask_w))<< 2 | gf2e_mul(ff, a, ((i>> 4)&mask_w))<< 4 | gf2e_mul(ff, a, ((i>> 6)&mask_w))<< 6;
-      mul[i] |= gf2e_mul(ff, a, ((i>>8)&mask_w))<<8 | gf2e_mul(ff, a, ((i>>10)&mask_w))<<10 | gf2e_mul(ff, a, ((i>>12)&mask_w))<<12 | gf2e_mul(ff, a, ((i>>14)&mask_w))<<14;
-      break;
-    case 4:
-      mul[i]  = gf2e_mul(ff, a, (i&mask_w)) | gf2e_mul(ff, a, ((i>>4)&mask_w))<<4 | gf2e_mul(ff, a, ((i>>8)&mask_w))<<8 | gf2e_mul(ff, a, ((i>>12)&mask_w))<<12;
-      break;
-    case 8:
-      mul[i]  = gf2e_mul(ff, a, (i&mask_w)) | gf2e_mul(ff, a, ((i>>8)&mask_w))<<8;
-      break;
-    case 16:
-      mul[i]  = gf2e_mul(ff, a, (i&mask_w));
-      break;
-    };
-  }
+  if (w > 16)
+    m4ri_die("gf2e_t16_init: elements do not fit into 16 bits.\n");
+
+  word basis[16];
+  for(unsigned int i=0; i<16; i++)
+    basis[i] = (i%w < ff->degree) ? gf2e_mul(ff, a, __M4RI_TWOPOW(i%w)) << (i - i%w) : 0;
+  _gf2e_span_gray(mul, basis, 16);
   return mul;
 }
 
@@ -182,6 +384,79 @@ static inline void gf2e_t16_free(word *mul) {
   m4ri_mm_free(mul);
 }
 
-extern const word* irreducible_polynomials[17];
+/**
+ * Compute all multiples by a of 16-bit elements split into two bytes.
+ *
+ * mul[b] is a*b and mul[256 + b] is a*(b<<8), hence a*x is mul[x & 0xff] ^ mul[256 + (x>>8)]. The
+ * table has 512 instead of 2^16 entries and thus fits into L1.
+ *
+ * \param ff Finite field with 8 < e <= 16.
+ * \param a Finite field element.
+ */
+
+static inline word *gf2e_t8_init(const gf2e *ff, const word a) {
+  word *mul = (word*)m4ri_mm_calloc(2*256, sizeof(word));
+
+  if (gf2e_degree_to_w(ff) != 16)
+    m4ri_die("gf2e_t8_init: elements are not 16 bits wide.\n");
+
+  word basis[16];
+  for(unsigned int i=0; i<16; i++)
+    basis[i] = (i < ff->degree) ? gf2e_mul(ff, a, __M4RI_TWOPOW(i)) : 0;
+  _gf2e_span_gray(mul, basis, 8);
+  _gf2e_span_gray(mul + 256, basis + 8, 8);
+  return mul;
+}
+
+/**
+ * \brief Free multiplication table.
+ *
+ * \param mul Multiplication table
+ */
+
+static inline void gf2e_t8_free(word *mul) {
+  m4ri_mm_free(mul);
+}
+
+/**
+ * Number of tables kept by gf2e_mul_table_get().
+ */
+
+#define M4RIE_MUL_TABLE_CACHE_SIZE 8
+
+/**
+ * \brief Return a shared multiplication table by a.
+ *
+ * For e <= 8 this is gf2e_t16_init(ff, a) and for 8 < e <= 16 it is gf2e_t8_init(ff, a). The
+ * M4RIE_MUL_TABLE_CACHE_SIZE most recently used tables are kept, such that repeated calls with the
+ * same scalar are free. Every call must be matched by a call to gf2e_mul_table_release().
+ *
+ * \param ff Finite field with e <= 16.
+ * \param a Finite field element.
+ */
+
+const word *gf2e_mul_table_get(const gf2e *ff, const word a);
+
+/**
+ * \brief Release a table obtained from gf2e_mul_table_get().
+ *
+ * \param mul Multiplication table.
+ */
+
+void gf2e_mul_table_release(const word *mul);
+
+/**
+ * \brief Free all cached multiplication tables which are not referenced anymore.
+ */
+
+void gf2e_mul_table_clear(void);
+
+/**
+ * irreducible_polynomials[e][0] is the number n of polynomials listed and irreducible_polynomials[e][1],
+ * ..., irreducible_polynomials[e][n] are irreducible polynomials of degree e in increasing order. For
+ * e <= 16 all of them are listed, for larger e only the first few.
+ */
+
+extern const word* irreducible_polynomials[M4RIE_MAX_DEGREE+1];
 
 #endif //M4RIE_GF2E_H
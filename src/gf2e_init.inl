@@ -0,0 +1,101 @@
+/**
+ * \brief construction of the tables of gf2e
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ *
+ * gf2e_init_mode() fills the tables of fields without precomputed tables with these functions and
+ * gf2e_tables_gen writes their output for the default minimal polynomials to gf2e_tables.c. They
+ * only need gf2x.h, hence the generator does not link against M4RI.
+ */
+
+/**
+ * Fill red[0..2^e-1] with the reductors for minpoly, red[i] is the multiple of minpoly whose bits
+ * from e upwards are i.
+ */
+
+static void _gf2e_red_fill(word *red, const word minpoly, const unsigned int degree) {
+  const word order = __M4RI_TWOPOW(degree);
+  for(word i=1; i<order; i++) {
+    word tmp = 0;
+    for(unsigned int j=0; j<degree; j++)
+      if (__M4RI_TWOPOW(j) & i)
+        tmp ^= minpoly<<j;
+    assert(red[tmp>>degree] == 0);
+    red[tmp>>degree] = tmp;
+  }
+}
+
+/**
+ * Fill pow_gen[0..2e-2] with X^i modulo minpoly.
+ */
+
+static void _gf2e_pow_gen_fill(word *pow_gen, const word minpoly, const unsigned int degree) {
+  const unsigned int n = 2*degree-1;
+  for(unsigned int i=0; i<n; i++) {
+    pow_gen[i] = __M4RI_TWOPOW(i);
+    for(unsigned int j=i; j>=degree; j--) {
+      if (pow_gen[i] & __M4RI_TWOPOW(j))
+        pow_gen[i] ^= minpoly<<(j - degree);
+    }
+  }
+}
+
+/**
+ * Fill mul[0..2^(2e)-1] with mul[i*2^e + j] = i*j.
+ */
+
+static void _gf2e_mul_fill(word *mul, const word *red, const unsigned int degree) {
+  const word order = __M4RI_TWOPOW(degree);
+  for(word i=1; i<order; i++) {
+    for(word j=1; j<order; j++) {
+      const word res = gf2x_mul(i, j, degree);
+      mul[i*order + j] = res ^ red[res>>degree];
+    }
+  }
+}
+
+/**
+ * Write the powers g^0, ..., g^(2^e-2) of the first primitive element g found to exp.
+ */
+
+static void _gf2e_primitive_powers(word *exp, const word *red, const unsigned int degree) {
+  const word order = __M4RI_TWOPOW(degree);
+
+  for(word g=2; g<order; g++) {
+    word a = 1;
+    word i = 0;
+    do {
+      exp[i++] = a;
+      a = gf2x_mul(a, g, degree);
+      a ^= red[a>>degree];
+    } while(a != 1);
+    if (i == order - 1)
+      break;
+  }
+}
+
+/**
+ * Fill log[0..2^e-1] and complete exp[0..2^(e+1)-1] given the powers of a primitive element in
+ * exp[0..2^e-2], exp is extended such that exp[log[a] + log[b]] = a*b.
+ */
+
+static void _gf2e_logexp_fill(word *log, word *exp, const unsigned int degree) {
+  const word order = __M4RI_TWOPOW(degree);
+  for(word i=0; i<order-1; i++) {
+    log[exp[i]] = i;
+    exp[i + order - 1] = exp[i];
+  }
+  exp[2*order - 2] = exp[0];
+}
+
+/**
+ * Fill inv[0..2^e-1] using \f$(g^i)^{-1} = g^{2^e-1-i}\f$ given the powers of a primitive element
+ * g in exp[0..2^e-2].
+ */
+
+static void _gf2e_inv_fill(word *inv, const word *exp, const unsigned int degree) {
+  const word order = __M4RI_TWOPOW(degree);
+  inv[0] = 0;
+  inv[1] = 1;
+  for(word i=1; i<order-1; i++)
+    inv[exp[i]] = exp[order - 1 - i];
+}
@@ -0,0 +1,644 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include "config.h"
+#include "gf2e_simd.h"
+
+#include "dispatch.h"
+
+#ifdef __M4RIE_HAVE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+void gf2e_simd_tab_init(gf2e_simd_tab_t *T, const gf2e *ff, const unsigned int w, const word x) {
+  /** b[k] = x * X^k restricted to the bits where a packed element can be non-zero **/
+  word b[16];
+  for(unsigned int k=0; k<16; k++) {
+    if (w <= 4)
+      b[k] = (k%w < ff->degree) ? ff->mul(ff, x, __M4RI_TWOPOW(k%w)) << (k - k%w) : 0;
+    else
+      b[k] = (k < ff->degree) ? ff->mul(ff, x, __M4RI_TWOPOW(k)) : 0;
+  }
+
+  T->w = w;
+  for(unsigned int i=0; i<16; i++) {
+    if (w <= 4) {
+      word v = 0;
+      for(unsigned int j=0; j<4; j++)
+        if (i & (1<<j))
+          v ^= b[j];
+      T->tab[0][i] = (unsigned char)v;
+      T->tab[1][i] = (unsigned char)(v<<4);
+    } else {
+      for(unsigned int p=0; p<w/4; p++) {
+        word v = 0;
+        for(unsigned int j=0; j<4; j++)
+          if (i & (1<<j))
+            v ^= b[4*p+j];
+        if (w == 8) {
+          T->tab[p][i] = (unsigned char)v;
+        } else {
+          T->tab[2*p+0][i] = (unsigned char)(v & 0xff);
+          T->tab[2*p+1][i] = (unsigned char)(v >> 8);
+        }
+      }
+    }
+  }
+
+  T->affine = 0;
+  if (w <= 8) {
+    for(unsigned int j=0; j<8; j++) {
+      const word img = (j < 4) ? T->tab[0][1<<j] : T->tab[1][1<<(j-4)];
+      for(unsigned int i=0; i<8; i++)
+        if (img & (1<<i))
+          T->affine |= m4ri_one << (8*(7-i) + j);
+    }
+  }
+}
+
+/**
+ * Scalar code using the same tables, used for the words the vector kernels leave over.
+ */
+
+static inline word _gf2e_simd_mul_word(const word v, const gf2e_simd_tab_t *T) {
+  word r = 0;
+  if (T->w <= 8) {
+    for(unsigned int k=0; k<64; k+=8) {
+      const word a = (v>>k) & 0xff;
+      r |= (word)(T->tab[0][a & 0xf] ^ T->tab[1][a>>4]) << k;
+    }
+  } else {
+    for(unsigned int k=0; k<64; k+=16) {
+      const word a = (v>>k) & 0xffff;
+      const word lo = T->tab[0][a & 0xf] ^ T->tab[2][(a>>4) & 0xf] ^ T->tab[4][(a>>8) & 0xf] ^ T->tab[6][a>>12];
+      const word hi = T->tab[1][a & 0xf] ^ T->tab[3][(a>>4) & 0xf] ^ T->tab[5][(a>>8) & 0xf] ^ T->tab[7][a>>12];
+      r |= (lo | hi<<8) << k;
+    }
+  }
+  return r;
+}
+
+static inline void _gf2e_simd_mul_scalar(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add) {
+  if (add) {
+    for(wi_t i=0; i<n; i++)
+      t[i] ^= _gf2e_simd_mul_word(f[i], T);
+  } else {
+    for(wi_t i=0; i<n; i++)
+      t[i] = _gf2e_simd_mul_word(f[i], T);
+  }
+}
+
+static inline void _gf2e_simd_mul_rows_scalar(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k,
+                                               wi_t i, const wi_t n) {
+  for(; i<n; i++) {
+    word r = t[i];
+    for(int j=0; j<k; j++)
+      r ^= _gf2e_simd_mul_word(f[j][i], T + j);
+    t[i] = r;
+  }
+}
+
+#ifdef __M4RIE_HAVE_X86_SIMD
+
+/**
+ * Process 16 bytes at a time, returns the number of words processed.
+ */
+
+__attribute__((target("ssse3")))
+static wi_t _gf2e_simd_mul_ssse3(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add) {
+  const __m128i mask = _mm_set1_epi8(0x0f);
+  wi_t i = 0;
+
+  if (T->w <= 8) {
+    const __m128i t0 = _mm_load_si128((const __m128i*)T->tab[0]);
+    const __m128i t1 = _mm_load_si128((const __m128i*)T->tab[1]);
+    for(; i+2 <= n; i+=2) {
+      const __m128i v = _mm_loadu_si128((const __m128i*)(f+i));
+      __m128i r = _mm_xor_si128(_mm_shuffle_epi8(t0, _mm_and_si128(v, mask)),
+                                _mm_shuffle_epi8(t1, _mm_and_si128(_mm_srli_epi16(v, 4), mask)));
+      if (add)
+        r = _mm_xor_si128(r, _mm_loadu_si128((const __m128i*)(t+i)));
+      _mm_storeu_si128((__m128i*)(t+i), r);
+    }
+  } else {
+    __m128i tt[8];
+    for(int k=0; k<8; k++)
+      tt[k] = _mm_load_si128((const __m128i*)T->tab[k]);
+    const __m128i m00ff = _mm_set1_epi16(0x00ff);
+    for(; i+4 <= n; i+=4) {
+      const __m128i a = _mm_loadu_si128((const __m128i*)(f+i+0));
+      const __m128i b = _mm_loadu_si128((const __m128i*)(f+i+2));
+      /** separate low and high bytes of the 16-bit elements **/
+      const __m128i lo = _mm_packus_epi16(_mm_and_si128(a, m00ff), _mm_and_si128(b, m00ff));
+      const __m128i hi = _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+      const __m128i n0 = _mm_and_si128(lo, mask);
+      const __m128i n1 = _mm_and_si128(_mm_srli_epi16(lo, 4), mask);
+      const __m128i n2 = _mm_and_si128(hi, mask);
+      const __m128i n3 = _mm_and_si128(_mm_srli_epi16(hi, 4), mask);
+      __m128i rl = _mm_xor_si128(_mm_shuffle_epi8(tt[0], n0), _mm_shuffle_epi8(tt[2], n1));
+      rl = _mm_xor_si128(rl, _mm_xor_si128(_mm_shuffle_epi8(tt[4], n2), _mm_shuffle_epi8(tt[6], n3)));
+      __m128i rh = _mm_xor_si128(_mm_shuffle_epi8(tt[1], n0), _mm_shuffle_epi8(tt[3], n1));
+      rh = _mm_xor_si128(rh, _mm_xor_si128(_mm_shuffle_epi8(tt[5], n2), _mm_shuffle_epi8(tt[7], n3)));
+      __m128i ra = _mm_unpacklo_epi8(rl, rh);
+      __m128i rb = _mm_unpackhi_epi8(rl, rh);
+      if (add) {
+        ra = _mm_xor_si128(ra, _mm_loadu_si128((const __m128i*)(t+i+0)));
+        rb = _mm_xor_si128(rb, _mm_loadu_si128((const __m128i*)(t+i+2)));
+      }
+      _mm_storeu_si128((__m128i*)(t+i+0), ra);
+      _mm_storeu_si128((__m128i*)(t+i+2), rb);
+    }
+  }
+  return i;
+}
+
+/**
+ * Process 32 bytes at a time, returns the number of words processed.
+ *
+ * PACKUSWB and PUNPCK*BW operate within 128-bit lanes, which is fine since they undo each other.
+ */
+
+__attribute__((target("avx2")))
+static wi_t _gf2e_simd_mul_avx2(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add) {
+  const __m256i mask = _mm256_set1_epi8(0x0f);
+  wi_t i = 0;
+
+  if (T->w <= 8) {
+    const __m256i t0 = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)T->tab[0]));
+    const __m256i t1 = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)T->tab[1]));
+    for(; i+4 <= n; i+=4) {
+      const __m256i v = _mm256_loadu_si256((const __m256i*)(f+i));
+      __m256i r = _mm256_xor_si256(_mm256_shuffle_epi8(t0, _mm256_and_si256(v, mask)),
+                                   _mm256_shuffle_epi8(t1, _mm256_and_si256(_mm256_srli_epi16(v, 4), mask)));
+      if (add)
+        r = _mm256_xor_si256(r, _mm256_loadu_si256((const __m256i*)(t+i)));
+      _mm256_storeu_si256((__m256i*)(t+i), r);
+    }
+  } else {
+    __m256i tt[8];
+    for(int k=0; k<8; k++)
+      tt[k] = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)T->tab[k]));
+    const __m256i m00ff = _mm256_set1_epi16(0x00ff);
+    for(; i+8 <= n; i+=8) {
+      const __m256i a = _mm256_loadu_si256((const __m256i*)(f+i+0));
+      const __m256i b = _mm256_loadu_si256((const __m256i*)(f+i+4));
+      const __m256i lo = _mm256_packus_epi16(_mm256_and_si256(a, m00ff), _mm256_and_si256(b, m00ff));
+      const __m256i hi = _mm256_packus_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8));
+      const __m256i n0 = _mm256_and_si256(lo, mask);
+      const __m256i n1 = _mm256_and_si256(_mm256_srli_epi16(lo, 4), mask);
+      const __m256i n2 = _mm256_and_si256(hi, mask);
+      const __m256i n3 = _mm256_and_si256(_mm256_srli_epi16(hi, 4), mask);
+      __m256i rl = _mm256_xor_si256(_mm256_shuffle_epi8(tt[0], n0), _mm256_shuffle_epi8(tt[2], n1));
+      rl = _mm256_xor_si256(rl, _mm256_xor_si256(_mm256_shuffle_epi8(tt[4], n2), _mm256_shuffle_epi8(tt[6], n3)));
+      __m256i rh = _mm256_xor_si256(_mm256_shuffle_epi8(tt[1], n0), _mm256_shuffle_epi8(tt[3], n1));
+      rh = _mm256_xor_si256(rh, _mm256_xor_si256(_mm256_shuffle_epi8(tt[5], n2), _mm256_shuffle_epi8(tt[7], n3)));
+      __m256i ra = _mm256_unpacklo_epi8(rl, rh);
+      __m256i rb = _mm256_unpackhi_epi8(rl, rh);
+      if (add) {
+        ra = _mm256_xor_si256(ra, _mm256_loadu_si256((const __m256i*)(t+i+0)));
+        rb = _mm256_xor_si256(rb, _mm256_loadu_si256((const __m256i*)(t+i+4)));
+      }
+      _mm256_storeu_si256((__m256i*)(t+i+0), ra);
+      _mm256_storeu_si256((__m256i*)(t+i+4), rb);
+    }
+  }
+  return i;
+}
+
+/**
+ * Process 32 bytes at a time for w <= 8, returns the number of words processed.
+ */
+
+__attribute__((target("gfni,avx2")))
+static wi_t _gf2e_simd_mul_gfni(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add) {
+  const __m256i A = _mm256_set1_epi64x(T->affine);
+  wi_t i = 0;
+  for(; i+4 <= n; i+=4) {
+    __m256i r = _mm256_gf2p8affine_epi64_epi8(_mm256_loadu_si256((const __m256i*)(f+i)), A, 0);
+    if (add)
+      r = _mm256_xor_si256(r, _mm256_loadu_si256((const __m256i*)(t+i)));
+    _mm256_storeu_si256((__m256i*)(t+i), r);
+  }
+  return i;
+}
+
+/**
+ * Process 64 bytes at a time for w <= 8, returns the number of words processed.
+ */
+
+__attribute__((target("gfni,avx512f,avx512bw")))
+static wi_t _gf2e_simd_mul_gfni_avx512(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add) {
+  const __m512i A = _mm512_set1_epi64(T->affine);
+  wi_t i = 0;
+  for(; i+8 <= n; i+=8) {
+    __m512i r = _mm512_gf2p8affine_epi64_epi8(_mm512_loadu_si512((const void*)(f+i)), A, 0);
+    if (add)
+      r = _mm512_xor_si512(r, _mm512_loadu_si512((const void*)(t+i)));
+    _mm512_storeu_si512((void*)(t+i), r);
+  }
+  return i;
+}
+
+/**
+ * The same for k source rows, the tables are reloaded for every row but stay in L1.
+ */
+
+__attribute__((target("ssse3")))
+static wi_t _gf2e_simd_mul_rows_ssse3_vec(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n) {
+  const __m128i mask = _mm_set1_epi8(0x0f);
+  wi_t i = 0;
+
+  if (T[0].w <= 8) {
+    for(; i+2 <= n; i+=2) {
+      __m128i r = _mm_loadu_si128((const __m128i*)(t+i));
+      for(int j=0; j<k; j++) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(f[j]+i));
+        r = _mm_xor_si128(r, _mm_shuffle_epi8(_mm_load_si128((const __m128i*)T[j].tab[0]), _mm_and_si128(v, mask)));
+        r = _mm_xor_si128(r, _mm_shuffle_epi8(_mm_load_si128((const __m128i*)T[j].tab[1]), _mm_and_si128(_mm_srli_epi16(v, 4), mask)));
+      }
+      _mm_storeu_si128((__m128i*)(t+i), r);
+    }
+  } else {
+    /** accumulate low and high product bytes separately and interleave them once **/
+    const __m128i m00ff = _mm_set1_epi16(0x00ff);
+    for(; i+4 <= n; i+=4) {
+      __m128i rl = _mm_setzero_si128();
+      __m128i rh = _mm_setzero_si128();
+      for(int j=0; j<k; j++) {
+        const __m128i a = _mm_loadu_si128((const __m128i*)(f[j]+i+0));
+        const __m128i b = _mm_loadu_si128((const __m128i*)(f[j]+i+2));
+        const __m128i lo = _mm_packus_epi16(_mm_and_si128(a, m00ff), _mm_and_si128(b, m00ff));
+        const __m128i hi = _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+        const __m128i nn[4] = {_mm_and_si128(lo, mask), _mm_and_si128(_mm_srli_epi16(lo, 4), mask),
+                               _mm_and_si128(hi, mask), _mm_and_si128(_mm_srli_epi16(hi, 4), mask)};
+        for(int p=0; p<4; p++) {
+          rl = _mm_xor_si128(rl, _mm_shuffle_epi8(_mm_load_si128((const __m128i*)T[j].tab[2*p+0]), nn[p]));
+          rh = _mm_xor_si128(rh, _mm_shuffle_epi8(_mm_load_si128((const __m128i*)T[j].tab[2*p+1]), nn[p]));
+        }
+      }
+      const __m128i ra = _mm_xor_si128(_mm_unpacklo_epi8(rl, rh), _mm_loadu_si128((const __m128i*)(t+i+0)));
+      const __m128i rb = _mm_xor_si128(_mm_unpackhi_epi8(rl, rh), _mm_loadu_si128((const __m128i*)(t+i+2)));
+      _mm_storeu_si128((__m128i*)(t+i+0), ra);
+      _mm_storeu_si128((__m128i*)(t+i+2), rb);
+    }
+  }
+  return i;
+}
+
+/**
+ * 64 bytes of t are processed per iteration such that each table is loaded once for two vectors.
+ */
+
+__attribute__((target("avx2")))
+static wi_t _gf2e_simd_mul_rows_avx2_vec(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n) {
+  const __m256i mask = _mm256_set1_epi8(0x0f);
+  wi_t i = 0;
+
+  if (T[0].w <= 8) {
+    for(; i+8 <= n; i+=8) {
+      __m256i r0 = _mm256_loadu_si256((const __m256i*)(t+i+0));
+      __m256i r1 = _mm256_loadu_si256((const __m256i*)(t+i+4));
+      for(int j=0; j<k; j++) {
+        const __m256i t0 = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)T[j].tab[0]));
+        const __m256i t1 = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)T[j].tab[1]));
+        const __m256i v0 = _mm256_loadu_si256((const __m256i*)(f[j]+i+0));
+        const __m256i v1 = _mm256_loadu_si256((const __m256i*)(f[j]+i+4));
+        r0 = _mm256_xor_si256(r0, _mm256_shuffle_epi8(t0, _mm256_and_si256(v0, mask)));
+        r0 = _mm256_xor_si256(r0, _mm256_shuffle_epi8(t1, _mm256_and_si256(_mm256_srli_epi16(v0, 4), mask)));
+        r1 = _mm256_xor_si256(r1, _mm256_shuffle_epi8(t0, _mm256_and_si256(v1, mask)));
+        r1 = _mm256_xor_si256(r1, _mm256_shuffle_epi8(t1, _mm256_and_si256(_mm256_srli_epi16(v1, 4), mask)));
+      }
+      _mm256_storeu_si256((__m256i*)(t+i+0), r0);
+      _mm256_storeu_si256((__m256i*)(t+i+4), r1);
+    }
+  } else {
+    const __m256i m00ff = _mm256_set1_epi16(0x00ff);
+    for(; i+8 <= n; i+=8) {
+      __m256i rl = _mm256_setzero_si256();
+      __m256i rh = _mm256_setzero_si256();
+      for(int j=0; j<k; j++) {
+        const __m256i a = _mm256_loadu_si256((const __m256i*)(f[j]+i+0));
+        const __m256i b = _mm256_loadu_si256((const __m256i*)(f[j]+i+4));
+        const __m256i lo = _mm256_packus_epi16(_mm256_and_si256(a, m00ff), _mm256_and_si256(b, m00ff));
+        const __m256i hi = _mm256_packus_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8));
+        const __m256i n0 = _mm256_and_si256(lo, mask);
+        const __m256i n1 = _mm256_and_si256(_mm256_srli_epi16(lo, 4), mask);
+        const __m256i n2 = _mm256_and_si256(hi, mask);
+        const __m256i n3 = _mm256_and_si256(_mm256_srli_epi16(hi, 4), mask);
+        const __m128i *tt = (const __m128i*)T[j].tab;
+        rl = _mm256_xor_si256(rl, _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(tt+0)), n0));
+        rh = _mm256_xor_si256(rh, _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(tt+1)), n0));
+        rl = _mm256_xor_si256(rl, _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(tt+2)), n1));
+        rh = _mm256_xor_si256(rh, _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(tt+3)), n1));
+        rl = _mm256_xor_si256(rl, _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(tt+4)), n2));
+        rh = _mm256_xor_si256(rh, _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(tt+5)), n2));
+        rl = _mm256_xor_si256(rl, _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(tt+6)), n3));
+        rh = _mm256_xor_si256(rh, _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(tt+7)), n3));
+      }
+      const __m256i ra = _mm256_xor_si256(_mm256_unpacklo_epi8(rl, rh), _mm256_loadu_si256((const __m256i*)(t+i+0)));
+      const __m256i rb = _mm256_xor_si256(_mm256_unpackhi_epi8(rl, rh), _mm256_loadu_si256((const __m256i*)(t+i+4)));
+      _mm256_storeu_si256((__m256i*)(t+i+0), ra);
+      _mm256_storeu_si256((__m256i*)(t+i+4), rb);
+    }
+  }
+  return i;
+}
+
+__attribute__((target("gfni,avx2")))
+static wi_t _gf2e_simd_mul_rows_gfni_vec(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n) {
+  wi_t i = 0;
+  for(; i+4 <= n; i+=4) {
+    __m256i r = _mm256_loadu_si256((const __m256i*)(t+i));
+    for(int j=0; j<k; j++)
+      r = _mm256_xor_si256(r, _mm256_gf2p8affine_epi64_epi8(_mm256_loadu_si256((const __m256i*)(f[j]+i)),
+                                                            _mm256_set1_epi64x(T[j].affine), 0));
+    _mm256_storeu_si256((__m256i*)(t+i), r);
+  }
+  return i;
+}
+
+__attribute__((target("gfni,avx512f,avx512bw")))
+static wi_t _gf2e_simd_mul_rows_gfni_avx512_vec(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n) {
+  wi_t i = 0;
+  for(; i+8 <= n; i+=8) {
+    __m512i r = _mm512_loadu_si512((const void*)(t+i));
+    for(int j=0; j<k; j++)
+      r = _mm512_xor_si512(r, _mm512_gf2p8affine_epi64_epi8(_mm512_loadu_si512((const void*)(f[j]+i)),
+                                                            _mm512_set1_epi64(T[j].affine), 0));
+    _mm512_storeu_si512((void*)(t+i), r);
+  }
+  return i;
+}
+
+/**
+ * Complete row kernels as selected by m4rie_dispatch_init().
+ */
+
+void _gf2e_simd_mul_ssse3_row(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add) {
+  const wi_t i = _gf2e_simd_mul_ssse3(t, f, n, T, add);
+  _gf2e_simd_mul_scalar(t+i, f+i, n-i, T, add);
+}
+
+void _gf2e_simd_mul_avx2_row(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add) {
+  wi_t i = _gf2e_simd_mul_avx2(t, f, n, T, add);
+  i += _gf2e_simd_mul_ssse3(t+i, f+i, n-i, T, add);
+  _gf2e_simd_mul_scalar(t+i, f+i, n-i, T, add);
+}
+
+void _gf2e_simd_mul_gfni_row(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add) {
+  wi_t i = _gf2e_simd_mul_gfni(t, f, n, T, add);
+  i += _gf2e_simd_mul_ssse3(t+i, f+i, n-i, T, add);
+  _gf2e_simd_mul_scalar(t+i, f+i, n-i, T, add);
+}
+
+void _gf2e_simd_mul_gfni_avx512_row(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add) {
+  wi_t i = _gf2e_simd_mul_gfni_avx512(t, f, n, T, add);
+  i += _gf2e_simd_mul_gfni(t+i, f+i, n-i, T, add);
+  i += _gf2e_simd_mul_ssse3(t+i, f+i, n-i, T, add);
+  _gf2e_simd_mul_scalar(t+i, f+i, n-i, T, add);
+}
+
+void _gf2e_simd_mul_rows_ssse3(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n) {
+  const wi_t i = _gf2e_simd_mul_rows_ssse3_vec(t, f, T, k, n);
+  _gf2e_simd_mul_rows_scalar(t, f, T, k, i, n);
+}
+
+void _gf2e_simd_mul_rows_avx2(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n) {
+  const wi_t i = _gf2e_simd_mul_rows_avx2_vec(t, f, T, k, n);
+  _gf2e_simd_mul_rows_scalar(t, f, T, k, i, n);
+}
+
+void _gf2e_simd_mul_rows_gfni(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n) {
+  const wi_t i = _gf2e_simd_mul_rows_gfni_vec(t, f, T, k, n);
+  _gf2e_simd_mul_rows_scalar(t, f, T, k, i, n);
+}
+
+void _gf2e_simd_mul_rows_gfni_avx512(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n) {
+  wi_t i = _gf2e_simd_mul_rows_gfni_avx512_vec(t, f, T, k, n);
+  if (i < n) {
+    /** at most seven words left, the 256-bit variant needs offset pointers **/
+    const word *g[__M4RIE_SIMD_MAX_ROWS];
+    for(int j=0; j<k; j++)
+      g[j] = f[j] + i;
+    i += _gf2e_simd_mul_rows_gfni_vec(t + i, g, T, k, n - i);
+  }
+  _gf2e_simd_mul_rows_scalar(t, f, T, k, i, n);
+}
+
+/**
+ * c[i] ^= t0[i] ^ ... ^ t3[i] (t7[i])
+ */
+
+__attribute__((target("sse2")))
+void _gf2e_simd_combine4_sse2(word *c, const word *t0, const word *t1, const word *t2, const word *t3, const wi_t n) {
+  wi_t i = 0;
+  for(; i+2 <= n; i+=2) {
+    __m128i r = _mm_loadu_si128((const __m128i*)(c+i));
+    r = _mm_xor_si128(r, _mm_xor_si128(_mm_loadu_si128((const __m128i*)(t0+i)), _mm_loadu_si128((const __m128i*)(t1+i))));
+    r = _mm_xor_si128(r, _mm_xor_si128(_mm_loadu_si128((const __m128i*)(t2+i)), _mm_loadu_si128((const __m128i*)(t3+i))));
+    _mm_storeu_si128((__m128i*)(c+i), r);
+  }
+  for(; i<n; i++)
+    c[i] ^= t0[i] ^ t1[i] ^ t2[i] ^ t3[i];
+}
+
+__attribute__((target("avx2")))
+void _gf2e_simd_combine4_avx2(word *c, const word *t0, const word *t1, const word *t2, const word *t3, const wi_t n) {
+  wi_t i = 0;
+  for(; i+4 <= n; i+=4) {
+    __m256i r = _mm256_loadu_si256((const __m256i*)(c+i));
+    r = _mm256_xor_si256(r, _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(t0+i)), _mm256_loadu_si256((const __m256i*)(t1+i))));
+    r = _mm256_xor_si256(r, _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(t2+i)), _mm256_loadu_si256((const __m256i*)(t3+i))));
+    _mm256_storeu_si256((__m256i*)(c+i), r);
+  }
+  for(; i<n; i++)
+    c[i] ^= t0[i] ^ t1[i] ^ t2[i] ^ t3[i];
+}
+
+__attribute__((target("avx512f")))
+void _gf2e_simd_combine4_avx512(word *c, const word *t0, const word *t1, const word *t2, const word *t3, const wi_t n) {
+  wi_t i = 0;
+  for(; i+8 <= n; i+=8) {
+    __m512i r = _mm512_loadu_si512((const void*)(c+i));
+    r = _mm512_xor_si512(r, _mm512_xor_si512(_mm512_loadu_si512((const void*)(t0+i)), _mm512_loadu_si512((const void*)(t1+i))));
+    r = _mm512_xor_si512(r, _mm512_xor_si512(_mm512_loadu_si512((const void*)(t2+i)), _mm512_loadu_si512((const void*)(t3+i))));
+    _mm512_storeu_si512((void*)(c+i), r);
+  }
+  for(; i<n; i++)
+    c[i] ^= t0[i] ^ t1[i] ^ t2[i] ^ t3[i];
+}
+
+__attribute__((target("sse2")))
+void _gf2e_simd_combine8_sse2(word *c, const word *t0, const word *t1, const word *t2, const word *t3,
+                              const word *t4, const word *t5, const word *t6, const word *t7, const wi_t n) {
+  wi_t i = 0;
+  for(; i+2 <= n; i+=2) {
+    __m128i r = _mm_loadu_si128((const __m128i*)(c+i));
+    __m128i s = _mm_loadu_si128((const __m128i*)(t4+i));
+    r = _mm_xor_si128(r, _mm_xor_si128(_mm_loadu_si128((const __m128i*)(t0+i)), _mm_loadu_si128((const __m128i*)(t1+i))));
+    s = _mm_xor_si128(s, _mm_xor_si128(_mm_loadu_si128((const __m128i*)(t5+i)), _mm_loadu_si128((const __m128i*)(t6+i))));
+    r = _mm_xor_si128(r, _mm_xor_si128(_mm_loadu_si128((const __m128i*)(t2+i)), _mm_loadu_si128((const __m128i*)(t3+i))));
+    s = _mm_xor_si128(s, _mm_loadu_si128((const __m128i*)(t7+i)));
+    _mm_storeu_si128((__m128i*)(c+i), _mm_xor_si128(r, s));
+  }
+  for(; i<n; i++)
+    c[i] ^= t0[i] ^ t1[i] ^ t2[i] ^ t3[i] ^ t4[i] ^ t5[i] ^ t6[i] ^ t7[i];
+}
+
+__attribute__((target("avx2")))
+void _gf2e_simd_combine8_avx2(word *c, const word *t0, const word *t1, const word *t2, const word *t3,
+                              const word *t4, const word *t5, const word *t6, const word *t7, const wi_t n) {
+  wi_t i = 0;
+  for(; i+4 <= n; i+=4) {
+    __m256i r = _mm256_loadu_si256((const __m256i*)(c+i));
+    __m256i s = _mm256_loadu_si256((const __m256i*)(t4+i));
+    r = _mm256_xor_si256(r, _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(t0+i)), _mm256_loadu_si256((const __m256i*)(t1+i))));
+    s = _mm256_xor_si256(s, _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(t5+i)), _mm256_loadu_si256((const __m256i*)(t6+i))));
+    r = _mm256_xor_si256(r, _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(t2+i)), _mm256_loadu_si256((const __m256i*)(t3+i))));
+    s = _mm256_xor_si256(s, _mm256_loadu_si256((const __m256i*)(t7+i)));
+    _mm256_storeu_si256((__m256i*)(c+i), _mm256_xor_si256(r, s));
+  }
+  for(; i<n; i++)
+    c[i] ^= t0[i] ^ t1[i] ^ t2[i] ^ t3[i] ^ t4[i] ^ t5[i] ^ t6[i] ^ t7[i];
+}
+
+__attribute__((target("avx512f")))
+void _gf2e_simd_combine8_avx512(word *c, const word *t0, const word *t1, const word *t2, const word *t3,
+                                const word *t4, const word *t5, const word *t6, const word *t7, const wi_t n) {
+  wi_t i = 0;
+  for(; i+8 <= n; i+=8) {
+    __m512i r = _mm512_loadu_si512((const void*)(c+i));
+    __m512i s = _mm512_loadu_si512((const void*)(t4+i));
+    r = _mm512_xor_si512(r, _mm512_xor_si512(_mm512_loadu_si512((const void*)(t0+i)), _mm512_loadu_si512((const void*)(t1+i))));
+    s = _mm512_xor_si512(s, _mm512_xor_si512(_mm512_loadu_si512((const void*)(t5+i)), _mm512_loadu_si512((const void*)(t6+i))));
+    r = _mm512_xor_si512(r, _mm512_xor_si512(_mm512_loadu_si512((const void*)(t2+i)), _mm512_loadu_si512((const void*)(t3+i))));
+    s = _mm512_xor_si512(s, _mm512_loadu_si512((const void*)(t7+i)));
+    _mm512_storeu_si512((void*)(c+i), _mm512_xor_si512(r, s));
+  }
+  for(; i<n; i++)
+    c[i] ^= t0[i] ^ t1[i] ^ t2[i] ^ t3[i] ^ t4[i] ^ t5[i] ^ t6[i] ^ t7[i];
+}
+
+/**
+ * Bit k of byte i is moved to the top of byte i by a left shift of 7-k, PMOVMSKB then collects
+ * these bits for 16 (32) bytes at once.
+ */
+
+__attribute__((target("sse2")))
+void _gf2e_simd_slice8_sse2(word *const *t, const unsigned int depth, const word *f, const wi_t n) {
+  for(wi_t j2=0; j2<n; j2++) {
+    const __m128i v0 = _mm_loadu_si128((const __m128i*)(f + 8*j2 + 0));
+    const __m128i v1 = _mm_loadu_si128((const __m128i*)(f + 8*j2 + 2));
+    const __m128i v2 = _mm_loadu_si128((const __m128i*)(f + 8*j2 + 4));
+    const __m128i v3 = _mm_loadu_si128((const __m128i*)(f + 8*j2 + 6));
+    for(unsigned int k=0; k<depth; k++) {
+      const __m128i s = _mm_cvtsi32_si128(7-k);
+      t[k][j2] = ((word)(unsigned int)_mm_movemask_epi8(_mm_sll_epi64(v0, s)) <<  0)
+        |        ((word)(unsigned int)_mm_movemask_epi8(_mm_sll_epi64(v1, s)) << 16)
+        |        ((word)(unsigned int)_mm_movemask_epi8(_mm_sll_epi64(v2, s)) << 32)
+        |        ((word)(unsigned int)_mm_movemask_epi8(_mm_sll_epi64(v3, s)) << 48);
+    }
+  }
+}
+
+__attribute__((target("avx2")))
+void _gf2e_simd_slice8_avx2(word *const *t, const unsigned int depth, const word *f, const wi_t n) {
+  for(wi_t j2=0; j2<n; j2++) {
+    const __m256i v0 = _mm256_loadu_si256((const __m256i*)(f + 8*j2 + 0));
+    const __m256i v1 = _mm256_loadu_si256((const __m256i*)(f + 8*j2 + 4));
+    for(unsigned int k=0; k<depth; k++) {
+      const __m128i s = _mm_cvtsi32_si128(7-k);
+      t[k][j2] = ((word)(unsigned int)_mm256_movemask_epi8(_mm256_sll_epi64(v0, s)) <<  0)
+        |        ((word)(unsigned int)_mm256_movemask_epi8(_mm256_sll_epi64(v1, s)) << 32);
+    }
+  }
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void _gf2e_simd_slice8_avx512(word *const *t, const unsigned int depth, const word *f, const wi_t n) {
+  for(wi_t j2=0; j2<n; j2++) {
+    const __m512i v = _mm512_loadu_si512((const void*)(f + 8*j2));
+    for(unsigned int k=0; k<depth; k++)
+      t[k][j2] = (word)_mm512_test_epi8_mask(v, _mm512_set1_epi8((char)(1<<k)));
+  }
+}
+
+/**
+ * Each bit of a 32-bit plane word is broadcast to its byte with PSHUFB, compared against a bit
+ * selector and the resulting byte mask selects bit k.
+ */
+
+__attribute__((target("avx2")))
+void _gf2e_simd_cling8_avx2(word *f, const word *const *t, const unsigned int depth, const wi_t n) {
+  const __m256i idx = _mm256_setr_epi8(0,0,0,0,0,0,0,0, 1,1,1,1,1,1,1,1, 2,2,2,2,2,2,2,2, 3,3,3,3,3,3,3,3);
+  const __m256i sel = _mm256_set1_epi64x(0x8040201008040201ULL);
+  for(wi_t j2=0; j2<n; j2++) {
+    __m256i r0 = _mm256_setzero_si256();
+    __m256i r1 = _mm256_setzero_si256();
+    for(unsigned int k=0; k<depth; k++) {
+      const __m256i bit = _mm256_set1_epi8((char)(1<<k));
+      const __m256i m0 = _mm256_shuffle_epi8(_mm256_set1_epi32((int)(t[k][j2] >>  0)), idx);
+      const __m256i m1 = _mm256_shuffle_epi8(_mm256_set1_epi32((int)(t[k][j2] >> 32)), idx);
+      r0 = _mm256_or_si256(r0, _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_and_si256(m0, sel), sel), bit));
+      r1 = _mm256_or_si256(r1, _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_and_si256(m1, sel), sel), bit));
+    }
+    _mm256_storeu_si256((__m256i*)(f + 8*j2 + 0), r0);
+    _mm256_storeu_si256((__m256i*)(f + 8*j2 + 4), r1);
+  }
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void _gf2e_simd_cling8_avx512(word *f, const word *const *t, const unsigned int depth, const wi_t n) {
+  for(wi_t j2=0; j2<n; j2++) {
+    __m512i r = _mm512_setzero_si512();
+    for(unsigned int k=0; k<depth; k++)
+      r = _mm512_or_si512(r, _mm512_maskz_mov_epi8((__mmask64)t[k][j2], _mm512_set1_epi8((char)(1<<k))));
+    _mm512_storeu_si512((void*)(f + 8*j2), r);
+  }
+}
+
+#endif //__M4RIE_HAVE_X86_SIMD
+
+void _gf2e_simd_mul_generic_row(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add) {
+  _gf2e_simd_mul_scalar(t, f, n, T, add);
+}
+
+void _gf2e_simd_mul_rows_generic(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n) {
+  _gf2e_simd_mul_rows_scalar(t, f, T, k, 0, n);
+}
+
+int gf2e_simd_available(void) {
+  return (m4rie_dispatch()->features & M4RIE_CPU_SSSE3) != 0;
+}
+
+void _gf2e_simd_mul(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add) {
+  const m4rie_dispatch_t *d = m4rie_dispatch();
+  if (T->w <= 8)
+    d->mul8(t, f, n, T, add);
+  else
+    d->mul16(t, f, n, T, add);
+}
+
+void _gf2e_simd_mul_rows(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n) {
+  const m4rie_dispatch_t *d = m4rie_dispatch();
+  if (T[0].w <= 8)
+    d->mul8_rows(t, f, T, k, n);
+  else
+    d->mul16_rows(t, f, T, k, n);
+}
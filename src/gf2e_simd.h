@@ -0,0 +1,235 @@
+/**
+ * \file gf2e_simd.h
+ *
+ * \brief Vectorised multiplication of packed \GF2E elements by a constant.
+ *
+ * Multiplication by a constant \f$x\f$ is \GF2-linear, hence the product of a packed byte (or
+ * 16-bit word) with \f$x\f$ is the XOR of lookups of its nibbles in 16-entry tables. These
+ * lookups are performed 16 (SSSE3) or 32 (AVX2) at a time using PSHUFB.
+ *
+ * For \f$w \leq 8\f$ the same map is an 8x8 matrix over \GF2 acting on each byte. On CPUs with
+ * GFNI it is applied to 32 (AVX2) or 64 (AVX-512) bytes at a time using GF2P8AFFINEQB.
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+#ifndef M4RIE_GF2E_SIMD_H
+#define M4RIE_GF2E_SIMD_H
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <m4ri/m4ri.h>
+#include <m4rie/gf2e.h>
+
+/**
+ * Rows with fewer words are multiplied using scalar code as building the tables does not pay off.
+ */
+
+#define __M4RIE_SIMD_CUTOFF 4
+
+/**
+ * Maximal number of source rows accumulated by one call to _gf2e_simd_mul_rows().
+ */
+
+#define __M4RIE_SIMD_MAX_ROWS 16
+
+/**
+ * Vector kernels are compiled with per-function target attributes and selected at runtime, see
+ * dispatch.h.
+ */
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define __M4RIE_HAVE_X86_SIMD 1
+#endif
+
+/**
+ * \brief Nibble lookup tables for multiplying packed elements of width w by a constant.
+ *
+ * For \f$w \leq 8\f$ tab[0] (tab[1]) maps the low (high) nibble of a byte to its contribution to
+ * the product byte. For \f$w = 16\f$ tab[2*p+q] maps nibble p of an element to byte q of its
+ * contribution to the product.
+ */
+
+typedef struct {
+  unsigned char tab[8][16] __attribute__((aligned(16))); /**< lookup tables */
+  word affine;     /**< matrix for GF2P8AFFINEQB, byte 7-i holds the input bits of output bit i (\f$w \leq 8\f$) */
+  unsigned int w;  /**< width of packed elements */
+} gf2e_simd_tab_t;
+
+/**
+ * \brief Fill T for multiplying elements of ff packed in width w by x.
+ *
+ * \param T Tables.
+ * \param ff Finite field.
+ * \param w Width of packed elements, one of 2, 4, 8, 16.
+ * \param x Finite field element.
+ */
+
+void gf2e_simd_tab_init(gf2e_simd_tab_t *T, const gf2e *ff, const unsigned int w, const word x);
+
+/**
+ * \brief Return TRUE if the CPU supports the vectorised kernels.
+ */
+
+int gf2e_simd_available(void);
+
+/**
+ * \brief t[i] = x*f[i] or t[i] = t[i] + x*f[i] for 0 <= i < n using T.
+ *
+ * \param t Target words.
+ * \param f Source words, may be t.
+ * \param n Number of words.
+ * \param T Tables created by gf2e_simd_tab_init().
+ * \param add If TRUE x*f is added to t.
+ *
+ * \warning Only call this function if gf2e_simd_available() returns TRUE.
+ */
+
+void _gf2e_simd_mul(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add);
+
+/**
+ * \brief t[i] = t[i] + x_0*f[0][i] + ... + x_{k-1}*f[k-1][i] for 0 <= i < n using T[0], ..., T[k-1].
+ *
+ * Each word of t is loaded and stored once, the k products are accumulated in registers.
+ *
+ * \param t Target words.
+ * \param f k arrays of source words, none of them may be t.
+ * \param T k tables created by gf2e_simd_tab_init() with the same w.
+ * \param k Number of source rows, at most __M4RIE_SIMD_MAX_ROWS.
+ * \param n Number of words.
+ *
+ * \warning Only call this function if gf2e_simd_available() returns TRUE.
+ */
+
+void _gf2e_simd_mul_rows(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n);
+
+/**
+ * \brief Row kernels behind _gf2e_simd_mul(), the suffix names the instruction set used.
+ */
+
+void _gf2e_simd_mul_generic_row(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add);
+
+/**
+ * \brief Row kernels behind _gf2e_simd_mul_rows(), the suffix names the instruction set used.
+ */
+
+void _gf2e_simd_mul_rows_generic(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n);
+
+#ifdef __M4RIE_HAVE_X86_SIMD
+
+void _gf2e_simd_mul_ssse3_row(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add);
+void _gf2e_simd_mul_avx2_row(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add);
+void _gf2e_simd_mul_gfni_row(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add);
+void _gf2e_simd_mul_gfni_avx512_row(word *t, const word *f, const wi_t n, const gf2e_simd_tab_t *T, const int add);
+
+void _gf2e_simd_mul_rows_ssse3(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n);
+void _gf2e_simd_mul_rows_avx2(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n);
+void _gf2e_simd_mul_rows_gfni(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n);
+void _gf2e_simd_mul_rows_gfni_avx512(word *t, const word *const *f, const gf2e_simd_tab_t *T, const int k, const wi_t n);
+
+/**
+ * \brief c[i] += t0[i] + ... + t3[i] for 0 <= i < n.
+ */
+
+void _gf2e_simd_combine4_sse2(word *c, const word *t0, const word *t1, const word *t2, const word *t3, const wi_t n);
+void _gf2e_simd_combine4_avx2(word *c, const word *t0, const word *t1, const word *t2, const word *t3, const wi_t n);
+void _gf2e_simd_combine4_avx512(word *c, const word *t0, const word *t1, const word *t2, const word *t3, const wi_t n);
+
+/**
+ * \brief c[i] += t0[i] + ... + t7[i] for 0 <= i < n.
+ */
+
+void _gf2e_simd_combine8_sse2(word *c, const word *t0, const word *t1, const word *t2, const word *t3,
+                              const word *t4, const word *t5, const word *t6, const word *t7, const wi_t n);
+void _gf2e_simd_combine8_avx2(word *c, const word *t0, const word *t1, const word *t2, const word *t3,
+                              const word *t4, const word *t5, const word *t6, const word *t7, const wi_t n);
+void _gf2e_simd_combine8_avx512(word *c, const word *t0, const word *t1, const word *t2, const word *t3,
+                                const word *t4, const word *t5, const word *t6, const word *t7, const wi_t n);
+
+/**
+ * \brief Write bit k of the 8n bytes in f to t[k][0], ..., t[k][n-1] for 0 <= k < depth.
+ */
+
+void _gf2e_simd_slice8_sse2(word *const *t, const unsigned int depth, const word *f, const wi_t n);
+void _gf2e_simd_slice8_avx2(word *const *t, const unsigned int depth, const word *f, const wi_t n);
+void _gf2e_simd_slice8_avx512(word *const *t, const unsigned int depth, const word *f, const wi_t n);
+
+/**
+ * \brief Inverse of _gf2e_simd_slice8_sse2(), writes 8n words to f.
+ */
+
+void _gf2e_simd_cling8_avx2(word *f, const word *const *t, const unsigned int depth, const wi_t n);
+void _gf2e_simd_cling8_avx512(word *f, const word *const *t, const unsigned int depth, const wi_t n);
+
+#endif //__M4RIE_HAVE_X86_SIMD
+
+/**
+ * \brief t[i] = x*f[i] or t[i] = t[i] + x*f[i] for 0 <= i < n if worthwhile.
+ *
+ * \param ff Finite field.
+ * \param w Width of packed elements.
+ * \param x Finite field element.
+ * \param t Target words.
+ * \param f Source words, may be t.
+ * \param n Number of words.
+ * \param add If TRUE x*f is added to t.
+ *
+ * \return TRUE if the words were processed, FALSE if the caller should fall back to scalar code.
+ */
+
+static inline int gf2e_simd_mul(const gf2e *ff, const unsigned int w, const word x, word *t, const word *f, const wi_t n, const int add) {
+  if (w > 16 || n < __M4RIE_SIMD_CUTOFF || !gf2e_simd_available())
+    return 0;
+  gf2e_simd_tab_t T;
+  gf2e_simd_tab_init(&T, ff, w, x);
+  _gf2e_simd_mul(t, f, n, &T, add);
+  return 1;
+}
+
+/**
+ * \brief t[i] = t[i] + x[0]*f[0][i] + ... + x[k-1]*f[k-1][i] for 0 <= i < n if worthwhile.
+ *
+ * \param ff Finite field.
+ * \param w Width of packed elements.
+ * \param x k finite field elements.
+ * \param k Number of source rows, at most __M4RIE_SIMD_MAX_ROWS.
+ * \param t Target words.
+ * \param f k arrays of source words, none of them may be t.
+ * \param offset Offset added to t and each f[j].
+ * \param n Number of words.
+ *
+ * \return TRUE if the words were processed, FALSE if the caller should fall back to scalar code.
+ */
+
+static inline int gf2e_simd_mul_rows(const gf2e *ff, const unsigned int w, const word *x, const int k,
+                                     word *t, const word *const *f, const wi_t offset, const wi_t n) {
+  if (w > 16 || n < __M4RIE_SIMD_CUTOFF || !gf2e_simd_available())
+    return 0;
+  gf2e_simd_tab_t T[__M4RIE_SIMD_MAX_ROWS];
+  const word *g[__M4RIE_SIMD_MAX_ROWS];
+  for(int j=0; j<k; j++) {
+    gf2e_simd_tab_init(T + j, ff, w, x[j]);
+    g[j] = f[j] + offset;
+  }
+  _gf2e_simd_mul_rows(t + offset, g, T, k, n);
+  return 1;
+}
+
+#endif //M4RIE_GF2E_SIMD_H
@@ -0,0 +1,67 @@
+/**
+ * \file gf2e_tables.h
+ *
+ * \brief Precomputed tables for the default minimal polynomials.
+ *
+ * The tables are generated at build time by gf2e_tables_gen and live in read-only memory.
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+#ifndef M4RIE_GF2E_TABLES_H
+#define M4RIE_GF2E_TABLES_H
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <m4ri/m4ri.h>
+#include "gf2e.h"
+
+/**
+ * \brief Read-only tables for one minimal polynomial, unavailable tables are NULL.
+ */
+
+typedef struct {
+  word minpoly;             /**< Minimal polynomial the tables were computed for or 0. */
+  const word *red;          /**< see gf2e::red */
+  const word *pow_gen;      /**< see gf2e::pow_gen */
+  const word *inv;          /**< see gf2e::_inv */
+  const word *const *mul;   /**< see gf2e::_mul, only for e <= 8 */
+  const word *log;          /**< see gf2e::_log, only for 9 <= e <= 12 */
+  const word *exp;          /**< see gf2e::_exp, only for 9 <= e <= 12 */
+} gf2e_static_tables_t;
+
+/**
+ * gf2e_static_tables[e] holds the tables for irreducible_polynomials[e][1].
+ */
+
+extern const gf2e_static_tables_t gf2e_static_tables[M4RIE_MAX_TABLE_DEGREE+1];
+
+/**
+ * \brief Return the static tables for minpoly or NULL.
+ */
+
+static inline const gf2e_static_tables_t *gf2e_static_tables_get(const word minpoly) {
+  const int degree = gf2x_deg(minpoly);
+  if (degree > M4RIE_MAX_TABLE_DEGREE || gf2e_static_tables[degree].minpoly != minpoly)
+    return NULL;
+  return gf2e_static_tables + degree;
+}
+
+#endif //M4RIE_GF2E_TABLES_H
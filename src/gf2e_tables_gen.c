@@ -0,0 +1,117 @@
+/**
+ * \file gf2e_tables_gen.c
+ *
+ * \brief Generate gf2e_tables.c holding the tables for the default minimal polynomials.
+ *
+ * Usage: gf2e_tables_gen > gf2e_tables.c
+ *
+ * The tables for irreducible_polynomials[e][1] are computed by the functions gf2e_init_mode()
+ * uses, see gf2e_init.inl, and gf2e_init_mode() only uses them if the minimal polynomial matches.
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <m4ri/m4ri.h>
+#include "gf2x.h"
+#include "gf2e.h"
+#include "irreducible_polynomials.inl"
+#include "gf2e_init.inl"
+
+static void print_table(const char *name, unsigned int e, const word *t, size_t n) {
+  printf("static const word _gf2e_%s_%02d[%zu] = {", name, e, n);
+  for(size_t i=0; i<n; i++) {
+    if (i%12 == 0)
+      printf("\n ");
+    printf(" 0x%05llx%s", (unsigned long long)t[i], (i+1<n) ? "," : "");
+  }
+  printf(" };\n\n");
+}
+
+int main(void) {
+  printf("/* generated by gf2e_tables_gen, do not edit */\n\n");
+  printf("#include <m4rie/gf2e_tables.h>\n\n");
+
+  for(unsigned int e=2; e<=M4RIE_MAX_TABLE_DEGREE; e++) {
+    const word minpoly = irreducible_polynomials[e][1];
+    const word order = __M4RI_TWOPOW(e);
+
+    word *red = (word*)calloc(order, sizeof(word));
+    _gf2e_red_fill(red, minpoly, e);
+    print_table("red", e, red, order);
+
+    word *pow_gen = (word*)calloc(2*e-1, sizeof(word));
+    _gf2e_pow_gen_fill(pow_gen, minpoly, e);
+    print_table("pow_gen", e, pow_gen, 2*e-1);
+
+    word *exp = (word*)calloc(2*order, sizeof(word));
+    _gf2e_primitive_powers(exp, red, e);
+
+    word *inv = (word*)calloc(order, sizeof(word));
+    _gf2e_inv_fill(inv, exp, e);
+    print_table("inv", e, inv, order);
+
+    if (e <= 8) {
+      word *mul = (word*)calloc(order*order, sizeof(word));
+      _gf2e_mul_fill(mul, red, e);
+      print_table("mul", e, mul, order*order);
+      printf("static const word *const _gf2e_mul_rows_%02d[%llu] = {", e, (unsigned long long)order);
+      for(word i=0; i<order; i++)
+        printf("%s_gf2e_mul_%02d + %5llu%s", (i%4 == 0) ? "\n  " : " ", e, (unsigned long long)(i*order), (i+1<order) ? "," : "");
+      printf(" };\n\n");
+      free(mul);
+    }
+
+    if (9 <= e && e <= 12) {
+      word *log = (word*)calloc(order, sizeof(word));
+      _gf2e_logexp_fill(log, exp, e);
+      print_table("log", e, log, order);
+      print_table("exp", e, exp, 2*order);
+      free(log);
+    }
+
+    free(red);
+    free(pow_gen);
+    free(exp);
+    free(inv);
+  }
+
+  printf("const gf2e_static_tables_t gf2e_static_tables[M4RIE_MAX_TABLE_DEGREE+1] = {\n");
+  printf("  {0, NULL, NULL, NULL, NULL, NULL, NULL},\n");
+  printf("  {0, NULL, NULL, NULL, NULL, NULL, NULL},\n");
+  for(unsigned int e=2; e<=M4RIE_MAX_TABLE_DEGREE; e++) {
+    printf("  {0x%05llx, _gf2e_red_%02d, _gf2e_pow_gen_%02d, _gf2e_inv_%02d, ", (unsigned long long)irreducible_polynomials[e][1], e, e, e);
+    if (e <= 8)
+      printf("_gf2e_mul_rows_%02d, ", e);
+    else
+      printf("NULL, ");
+    if (9 <= e && e <= 12)
+      printf("_gf2e_log_%02d, _gf2e_exp_%02d}", e, e);
+    else
+      printf("NULL, NULL}");
+    printf("%s\n", (e < M4RIE_MAX_TABLE_DEGREE) ? "," : "");
+  }
+  printf("};\n");
+  return 0;
+}
@@ -0,0 +1,833 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "config.h"
+#ifdef HAVE_SYS_MMAN_H
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+#include "io.h"
+#include "conversion.h"
+
+/**
+ * Number of hexadecimal digits of an element, as in mzed_print().
+ */
+
+static inline int _m4rie_hex_digits(const wi_t w) {
+  return (w + 3)/4;
+}
+
+/**
+ * Write the 16 hexadecimal digits of v to s, most significant first.
+ *
+ * The eight nibbles of each half are spread to one byte each and turned into ASCII at once, digits
+ * above 9 get 'a' - '0' - 10 added.
+ */
+
+static inline void _m4rie_hex_word(char *s, const word v) {
+  for(int h=0; h<2; h++) {
+    word x = (v >> (32*(1-h))) & 0xffffffffULL;
+    x = (x | (x << 16)) & 0x0000ffff0000ffffULL;
+    x = (x | (x <<  8)) & 0x00ff00ff00ff00ffULL;
+    x = (x | (x <<  4)) & 0x0f0f0f0f0f0f0f0fULL;
+    const word alpha = ((x + 0x0606060606060606ULL) >> 4) & 0x0101010101010101ULL;
+    x += 0x3030303030303030ULL + alpha*('a' - '0' - 10);
+    for(int k=0; k<8; k++)
+      s[8*h + k] = (char)(x >> (8*(7-k)));
+  }
+}
+
+static inline void _m4rie_hex_elem(char *s, word v, const int d) {
+  for(int k=d-1; k>=0; k--) {
+    s[k] = "0123456789abcdef"[v & 0xf];
+    v >>= 4;
+  }
+}
+
+static inline int _m4rie_hex_value(const char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  const char l = c | 0x20;
+  if (l >= 'a' && l <= 'f')
+    return l - 'a' + 10;
+  return -1;
+}
+
+static inline int _m4rie_is_separator(const char c) {
+  return c == ' ' || c == ',' || c == '\n' || c == '\t' || c == '\r';
+}
+
+static inline int _m4rie_dec_len(word v) {
+  int len = 1;
+  while (v >= 10) {
+    v /= 10;
+    len++;
+  }
+  return len;
+}
+
+static inline int _m4rie_dec(char *s, word v) {
+  const int len = _m4rie_dec_len(v);
+  for(int k=len-1; k>=0; k--) {
+    s[k] = '0' + (char)(v % 10);
+    v /= 10;
+  }
+  return len;
+}
+
+/**
+ * Write the digits of A[i,j] to s + j*stride for all j.
+ *
+ * Unless elements are narrower than a digit each word of the row is converted with one call to
+ * _m4rie_hex_word() and the digits of its elements are copied out.
+ */
+
+static void _mzed_hex_row(char *s, const size_t stride, const mzed_t *A, const rci_t i) {
+  const int d = _m4rie_hex_digits(A->w);
+
+  if (A->w >= 4 && A->x->offset == 0) {
+    const word *row = A->x->rows[i];
+    const int epw = m4ri_radix/A->w;
+    char tmp[16];
+    for(rci_t j=0; j<A->ncols; j+=epw) {
+      _m4rie_hex_word(tmp, row[j/epw]);
+      const int e_max = MIN(epw, A->ncols - j);
+      for(int e=0; e<e_max; e++)
+        memcpy(s + (j+e)*stride, tmp + 16 - (e+1)*d, d);
+    }
+  } else {
+    for(rci_t j=0; j<A->ncols; j++)
+      _m4rie_hex_elem(s + j*stride, mzed_read_elem(A, i, j), d);
+  }
+}
+
+static rci_t _mzed_row_nnz(const mzed_t *A, const rci_t i) {
+  rci_t nnz = 0;
+  for(rci_t j=0; j<A->ncols; j++)
+    nnz += (mzed_read_elem(A, i, j) != 0);
+  return nnz;
+}
+
+static size_t _mzed_row_length(const mzed_t *A, const rci_t i, const m4rie_format_t format) {
+  const size_t n = A->ncols;
+  const size_t d = _m4rie_hex_digits(A->w);
+
+  switch(format) {
+  case M4RIE_FORMAT_PLAIN:
+    return n ? n*(d+1) + 2 : 3;
+  case M4RIE_FORMAT_SAGE:
+    return n ? n*(d+4) + 3 : 5;
+  default: {
+    const size_t li = _m4rie_dec_len(i+1);
+    size_t len = 0;
+    for(rci_t j=0; j<A->ncols; j++) {
+      const word v = mzed_read_elem(A, i, j);
+      if (v)
+        len += li + _m4rie_dec_len(j+1) + _m4rie_dec_len(v) + 3;
+    }
+    return len;
+  }
+  }
+}
+
+static void _mzed_format_row(char *s, const mzed_t *A, const rci_t i, const m4rie_format_t format) {
+  const rci_t n = A->ncols;
+  const int d = _m4rie_hex_digits(A->w);
+
+  switch(format) {
+  case M4RIE_FORMAT_PLAIN: {
+    s[0] = '[';
+    for(rci_t j=0; j+1<n; j++)
+      s[1 + j*(d+1) + d] = ' ';
+    _mzed_hex_row(s + 1, d+1, A, i);
+    /** mzed_print() pads with blanks **/
+    for(rci_t j=0; j<n; j++) {
+      char *e = s + 1 + j*(d+1);
+      for(int k=0; k<d-1 && e[k] == '0'; k++)
+        e[k] = ' ';
+    }
+    s += n ? n*(d+1) : 1;
+    s[0] = ']';
+    s[1] = '\n';
+    break;
+  }
+  case M4RIE_FORMAT_SAGE: {
+    s[0] = (i == 0) ? '[' : ' ';
+    s[1] = '[';
+    for(rci_t j=0; j<n; j++) {
+      char *e = s + 2 + j*(d+4);
+      e[0] = '0';
+      e[1] = 'x';
+      if (j+1<n) {
+        e[d+2] = ',';
+        e[d+3] = ' ';
+      }
+    }
+    _mzed_hex_row(s + 4, d+4, A, i);
+    s += n ? n*(d+4) : 2;
+    s[0] = ']';
+    s[1] = (i == A->nrows - 1) ? ']' : ',';
+    s[2] = '\n';
+    break;
+  }
+  default: {
+    char ri[16];
+    const int li = _m4rie_dec(ri, i+1);
+    for(rci_t j=0; j<n; j++) {
+      const word v = mzed_read_elem(A, i, j);
+      if (v == 0)
+        continue;
+      memcpy(s, ri, li);
+      s += li;
+      *s++ = ' ';
+      s += _m4rie_dec(s, j+1);
+      *s++ = ' ';
+      s += _m4rie_dec(s, v);
+      *s++ = '\n';
+    }
+    break;
+  }
+  }
+}
+
+/**
+ * Format the rows r0 <= i < r1 of A to *buf + pos, growing *buf if needed. Returns the new
+ * position.
+ *
+ * The length of every row is computed first, hence all rows can be formatted in parallel.
+ */
+
+static size_t _mzed_format_rows(char **buf, size_t *cap, size_t pos, const mzed_t *A,
+                                const rci_t r0, const rci_t r1, const m4rie_format_t format) {
+  size_t *offset = (size_t*)malloc((r1 - r0 + 1)*sizeof(size_t));
+  const int parallel = ((size_t)(r1 - r0)*A->ncols > __M4RIE_IO_PARALLEL_CUTOFF);
+  (void)parallel;
+
+  offset[0] = pos;
+#ifdef HAVE_OPENMP
+#pragma omp parallel for schedule(static) if(parallel)
+#endif
+  for(rci_t i=r0; i<r1; i++)
+    offset[i - r0 + 1] = _mzed_row_length(A, i, format);
+  for(rci_t i=r0; i<r1; i++)
+    offset[i - r0 + 1] += offset[i - r0];
+
+  if (offset[r1 - r0] + 1 > *cap) {
+    *cap = offset[r1 - r0] + 1;
+    *buf = (char*)realloc(*buf, *cap);
+  }
+  char *s = *buf;
+
+#ifdef HAVE_OPENMP
+#pragma omp parallel for schedule(static) if(parallel)
+#endif
+  for(rci_t i=r0; i<r1; i++)
+    _mzed_format_row(s + offset[i - r0], A, i, format);
+
+  pos = offset[r1 - r0];
+  free(offset);
+  return pos;
+}
+
+static word _mzed_nnz(const mzed_t *A) {
+  word nnz = 0;
+#ifdef HAVE_OPENMP
+#pragma omp parallel for schedule(static) reduction(+:nnz) if((size_t)A->nrows*A->ncols > __M4RIE_IO_PARALLEL_CUTOFF)
+#endif
+  for(rci_t i=0; i<A->nrows; i++)
+    nnz += _mzed_row_nnz(A, i);
+  return nnz;
+}
+
+/**
+ * Everything before the first row, at most 256 bytes.
+ */
+
+static size_t _mzed_format_header(char *s, const mzed_t *A, const m4rie_format_t format) {
+  switch(format) {
+  case M4RIE_FORMAT_PLAIN:
+    return 0;
+  case M4RIE_FORMAT_SAGE:
+    if (A->nrows)
+      return 0;
+    strcpy(s, "[]\n");
+    return 3;
+  default:
+    return sprintf(s, "%%%%MatrixMarket matrix coordinate integer general\n"
+                   "%% GF(2^%u) modulus 0x%llx\n"
+                   "%d %d %llu\n",
+                   A->finite_field->degree, (unsigned long long)A->finite_field->minpoly,
+                   (int)A->nrows, (int)A->ncols, (unsigned long long)_mzed_nnz(A));
+  }
+}
+
+char *mzed_to_string(const mzed_t *A, const m4rie_format_t format) {
+  size_t cap = 256;
+  char *s = (char*)malloc(cap);
+  size_t len = _mzed_format_header(s, A, format);
+  len = _mzed_format_rows(&s, &cap, len, A, 0, A->nrows, format);
+  s[len] = '\0';
+  return s;
+}
+
+int mzed_fprint(FILE *stream, const mzed_t *A, const m4rie_format_t format) {
+  size_t cap = 256;
+  char *s = (char*)malloc(cap);
+  int ret = 0;
+
+  size_t len = _mzed_format_header(s, A, format);
+  if (len && fwrite(s, 1, len, stream) != len)
+    ret = -1;
+
+  /** a guess for Matrix Market **/
+  const size_t row_length = (A->ncols + 1)*(_m4rie_hex_digits(A->w) + 4);
+  const rci_t step = MAX(1, __M4RIE_IO_BLOCK_SIZE/row_length);
+  for(rci_t r=0; r<A->nrows && ret == 0; r+=step) {
+    len = _mzed_format_rows(&s, &cap, 0, A, r, MIN(r + step, A->nrows), format);
+    if (fwrite(s, 1, len, stream) != len)
+      ret = -1;
+  }
+  free(s);
+  return ret;
+}
+
+/**
+ * Parse the elements of the row between p and end into row, which is zero. If row is NULL the
+ * elements are only counted. Returns the number of elements or -1 if the row is malformed or has
+ * more than n elements.
+ */
+
+static rci_t _mzed_parse_row(word *row, const rci_t n, const wi_t w, const unsigned int degree,
+                             const char *p, const char *end) {
+  const int epw = m4ri_radix/w;
+  rci_t j = 0;
+
+  while (1) {
+    while (p < end && _m4rie_is_separator(*p))
+      p++;
+    if (p == end)
+      break;
+
+    if (p[0] == '0' && p + 1 < end && (p[1] | 0x20) == 'x')
+      p += 2;
+    word v = 0;
+    int h, nd = 0;
+    while (p < end && (h = _m4rie_hex_value(*p)) >= 0) {
+      v = v<<4 | h;
+      if (v >> degree)
+        return -1;
+      nd++;
+      p++;
+    }
+    if (nd == 0 || (p < end && !_m4rie_is_separator(*p)))
+      return -1;
+
+    if (row) {
+      if (j >= n)
+        return -1;
+      row[j/epw] |= v << (w*(j%epw));
+    }
+    j++;
+  }
+  return j;
+}
+
+static mzed_t *_mzed_from_matrix_market(const gf2e *ff, const char *str) {
+  char object[16], layout[16], field[16], symmetry[16];
+  if (sscanf(str, "%%%%MatrixMarket %15s %15s %15s %15s", object, layout, field, symmetry) != 4)
+    return NULL;
+  if (strcasecmp(object, "matrix") || strcasecmp(layout, "coordinate") ||
+      strcasecmp(field, "integer") || strcasecmp(symmetry, "general"))
+    return NULL;
+
+  /** skip the banner, comments and blank lines but check the field we wrote **/
+  const char *p = str;
+  while (*p == '%' || *p == '\n' || *p == '\r') {
+    unsigned int degree;
+    unsigned long long minpoly;
+    if (sscanf(p, "%% GF(2^%u) modulus %llx", &degree, &minpoly) == 2 &&
+        (degree != ff->degree || minpoly != (unsigned long long)ff->minpoly))
+      return NULL;
+    while (*p && *p != '\n')
+      p++;
+    if (*p)
+      p++;
+  }
+
+  char *end;
+  const long m = strtol(p, &end, 10);
+  const long n = strtol(p = end, &end, 10);
+  const long nnz = strtol(p = end, &end, 10);
+  if (end == p || m < 0 || n < 0 || nnz < 0 || nnz > m*n)
+    return NULL;
+  p = end;
+
+  mzed_t *A = mzed_init(ff, m, n);
+  for(long k=0; k<nnz; k++) {
+    const long i = strtol(p, &end, 10);
+    const long j = strtol(p = end, &end, 10);
+    const unsigned long long v = strtoull(p = end, &end, 10);
+    if (end == p || i < 1 || i > m || j < 1 || j > n || (v >> ff->degree)) {
+      mzed_free(A);
+      return NULL;
+    }
+    p = end;
+    mzed_write_elem(A, i-1, j-1, v);
+  }
+  return A;
+}
+
+mzed_t *mzed_from_string(const gf2e *ff, const char *str, const m4rie_format_t format) {
+  if (format == M4RIE_FORMAT_MATRIX_MARKET)
+    return _mzed_from_matrix_market(ff, str);
+
+  /** rows are the innermost brackets **/
+  const int row_depth = (format == M4RIE_FORMAT_SAGE) ? 2 : 1;
+  size_t cap = 64;
+  const char **begin = (const char**)malloc(2*cap*sizeof(const char*));
+  rci_t m = 0;
+  int depth = 0, lists = 0, ok = 1;
+
+  for(const char *p = str; *p && ok; p++) {
+    if (*p == '[') {
+      if (depth == 0)
+        lists++;
+      if (++depth > row_depth) {
+        ok = 0;
+      } else if (depth == row_depth) {
+        if ((size_t)m == cap) {
+          cap *= 2;
+          begin = (const char**)realloc(begin, 2*cap*sizeof(const char*));
+        }
+        begin[2*m] = p + 1;
+      }
+    } else if (*p == ']') {
+      if (depth == 0)
+        ok = 0;
+      else if (depth-- == row_depth)
+        begin[2*m++ + 1] = p;
+    } else if (depth < row_depth && !_m4rie_is_separator(*p)) {
+      ok = 0;
+    }
+  }
+  /** Sage matrices are exactly one list of rows **/
+  if (!ok || depth != 0 || (row_depth == 2 && lists != 1)) {
+    free(begin);
+    return NULL;
+  }
+
+  const wi_t w = gf2e_degree_to_w(ff);
+  const rci_t n = m ? _mzed_parse_row(NULL, 0, w, ff->degree, begin[0], begin[1]) : 0;
+  if (n < 0) {
+    free(begin);
+    return NULL;
+  }
+
+  mzed_t *A = mzed_init(ff, m, n);
+#ifdef HAVE_OPENMP
+#pragma omp parallel for schedule(static) reduction(&:ok) if((size_t)m*n > __M4RIE_IO_PARALLEL_CUTOFF)
+#endif
+  for(rci_t i=0; i<m; i++)
+    ok &= (_mzed_parse_row(A->x->rows[i], n, w, ff->degree, begin[2*i], begin[2*i+1]) == n);
+  free(begin);
+
+  if (!ok) {
+    mzed_free(A);
+    return NULL;
+  }
+  return A;
+}
+
+/**
+ * Read the remainder of stream into a null-terminated string.
+ */
+
+static char *_m4rie_read_stream(FILE *stream, size_t *length) {
+  size_t cap = 1<<16, len = 0, r;
+  char *s = (char*)malloc(cap);
+  while ((r = fread(s + len, 1, cap - len - 1, stream)) > 0) {
+    len += r;
+    if (len + 1 == cap) {
+      cap *= 2;
+      s = (char*)realloc(s, cap);
+    }
+  }
+  s[len] = '\0';
+  if (length)
+    *length = len;
+  return s;
+}
+
+mzed_t *mzed_fscan(FILE *stream, const gf2e *ff, const m4rie_format_t format) {
+  char *s = _m4rie_read_stream(stream, NULL);
+  mzed_t *A = mzed_from_string(ff, s, format);
+  free(s);
+  return A;
+}
+
+char *mzd_slice_to_string(const mzd_slice_t *A, const m4rie_format_t format) {
+  mzed_t *B = mzed_cling(NULL, A);
+  char *s = mzed_to_string(B, format);
+  mzed_free(B);
+  return s;
+}
+
+mzd_slice_t *mzd_slice_from_string(const gf2e *ff, const char *str, const m4rie_format_t format) {
+  mzed_t *B = mzed_from_string(ff, str, format);
+  if (B == NULL)
+    return NULL;
+  mzd_slice_t *A = mzed_slice(NULL, B);
+  mzed_free(B);
+  return A;
+}
+
+int mzd_slice_fprint(FILE *stream, const mzd_slice_t *A, const m4rie_format_t format) {
+  mzed_t *B = mzed_cling(NULL, A);
+  const int ret = mzed_fprint(stream, B, format);
+  mzed_free(B);
+  return ret;
+}
+
+mzd_slice_t *mzd_slice_fscan(FILE *stream, const gf2e *ff, const m4rie_format_t format) {
+  mzed_t *B = mzed_fscan(stream, ff, format);
+  if (B == NULL)
+    return NULL;
+  mzd_slice_t *A = mzed_slice(NULL, B);
+  mzed_free(B);
+  return A;
+}
+
+static const char _m4rie_file_magic[8] = {'M', '4', 'R', 'I', 'E', 'M', 'A', 'T'};
+
+#define __M4RIE_FILE_BYTEORDER 0x0102030405060708ULL
+
+/**
+ * Rows are padded as in M4RI, i.e. to an even number of words unless they are narrow.
+ */
+
+static inline wi_t _m4rie_file_rowstride(const wi_t width) {
+  return (width < 3 || width % 2 == 0) ? width : width + 1;
+}
+
+static void _m4rie_file_header(m4rie_file_header_t *h, const gf2e *ff, const rci_t m, const rci_t n,
+                               const wi_t w, const uint32_t planes) {
+  memset(h, 0, sizeof(m4rie_file_header_t));
+  memcpy(h->magic, _m4rie_file_magic, 8);
+  h->version = M4RIE_FILE_VERSION;
+  h->planes = planes;
+  h->byteorder = __M4RIE_FILE_BYTEORDER;
+  h->minpoly = ff->minpoly;
+  h->nrows = m;
+  h->ncols = n;
+  h->degree = ff->degree;
+  h->w = w;
+  h->rowstride = _m4rie_file_rowstride((w*n + m4ri_radix - 1)/m4ri_radix);
+}
+
+/**
+ * Append the rows of A padded to rowstride words, bits beyond the last column are cleared.
+ */
+
+static int _mzd_file_append(FILE *fh, const mzd_t *A, const uint64_t rowstride) {
+  word *buf = (word*)calloc(rowstride + 1, sizeof(word));
+  const word mask = __M4RI_LEFT_BITMASK(A->ncols % m4ri_radix);
+  int ret = 0;
+  for(rci_t i=0; i<A->nrows && ret == 0; i++) {
+    for(wi_t j=0; j<A->width; j++)
+      buf[j] = A->offset ? mzd_read_bits(A, i, j*m4ri_radix, MIN(m4ri_radix, A->ncols - j*m4ri_radix)) : A->rows[i][j];
+    if (A->width)
+      buf[A->width-1] &= mask;
+    if (fwrite(buf, sizeof(word), rowstride, fh) != rowstride)
+      ret = -1;
+  }
+  free(buf);
+  return ret;
+}
+
+static FILE *_m4rie_file_create(const char *filename, const m4rie_file_header_t *h) {
+  FILE *fh = fopen(filename, "wb");
+  if (fh == NULL)
+    return NULL;
+  if (fwrite(h, sizeof(m4rie_file_header_t), 1, fh) != 1) {
+    fclose(fh);
+    return NULL;
+  }
+  return fh;
+}
+
+FILE *_mzed_file_create(const char *filename, const gf2e *ff, const rci_t m, const rci_t n) {
+  m4rie_file_header_t h;
+  _m4rie_file_header(&h, ff, m, n, gf2e_degree_to_w(ff), 0);
+  return _m4rie_file_create(filename, &h);
+}
+
+int _mzed_file_append(FILE *fh, const mzed_t *A) {
+  return _mzd_file_append(fh, A->x, _m4rie_file_rowstride((A->x->ncols + m4ri_radix - 1)/m4ri_radix));
+}
+
+int mzed_write_file(const mzed_t *A, const char *filename) {
+  FILE *fh = _mzed_file_create(filename, A->finite_field, A->nrows, A->ncols);
+  if (fh == NULL)
+    return -1;
+  int ret = _mzed_file_append(fh, A);
+  if (fclose(fh) != 0)
+    ret = -1;
+  return ret;
+}
+
+int mzd_slice_write_file(const mzd_slice_t *A, const char *filename) {
+  m4rie_file_header_t h;
+  _m4rie_file_header(&h, A->finite_field, A->nrows, A->ncols, 1, A->depth);
+  FILE *fh = _m4rie_file_create(filename, &h);
+  if (fh == NULL)
+    return -1;
+  int ret = 0;
+  for(int k=0; k<A->depth && ret == 0; k++)
+    ret = _mzd_file_append(fh, A->x[k], h.rowstride);
+  if (fclose(fh) != 0)
+    ret = -1;
+  return ret;
+}
+
+/**
+ * Check the header h of a file of len bytes against ff and the number of planes.
+ */
+
+static int _m4rie_file_header_ok(const m4rie_file_header_t *h, const gf2e *ff, const uint32_t planes, size_t len) {
+  const wi_t w = planes ? 1 : gf2e_degree_to_w(ff);
+  int ok = (memcmp(h->magic, _m4rie_file_magic, 8) == 0);
+  ok = ok && h->version == M4RIE_FILE_VERSION && h->byteorder == __M4RIE_FILE_BYTEORDER;
+  ok = ok && h->planes == planes && h->minpoly == ff->minpoly && h->degree == ff->degree && h->w == (uint32_t)w;
+  ok = ok && h->nrows >= 0 && h->ncols >= 0 && h->nrows < ((int64_t)1 << 31) && w*h->ncols < ((int64_t)1 << 31);
+  ok = ok && h->rowstride == (uint64_t)_m4rie_file_rowstride((w*h->ncols + m4ri_radix - 1)/m4ri_radix);
+  ok = ok && len >= sizeof(m4rie_file_header_t);
+  len -= sizeof(m4rie_file_header_t);
+  ok = ok && len % sizeof(word) == 0 && len/sizeof(word) == MAX(planes, 1)*(h->nrows*h->rowstride);
+  return ok;
+}
+
+static void _m4rie_unmap(void *p, const size_t len) {
+#ifdef HAVE_SYS_MMAN_H
+  munmap(p, len);
+#else
+  free(p);
+#endif
+}
+
+/**
+ * Map filename and check it against ff and the number of planes. The rows start right after the
+ * returned header.
+ *
+ * Without mmap() the file is read into memory instead.
+ */
+
+static m4rie_file_header_t *_m4rie_map_file(const gf2e *ff, const char *filename, const uint32_t planes) {
+  size_t len;
+#ifdef HAVE_SYS_MMAN_H
+  const int fd = open(filename, O_RDONLY);
+  if (fd < 0)
+    return NULL;
+  struct stat st;
+  if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(m4rie_file_header_t)) {
+    close(fd);
+    return NULL;
+  }
+  len = st.st_size;
+  void *p = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED)
+    return NULL;
+#else
+  FILE *fh = fopen(filename, "rb");
+  if (fh == NULL)
+    return NULL;
+  void *p = _m4rie_read_stream(fh, &len);
+  fclose(fh);
+  if (len < sizeof(m4rie_file_header_t)) {
+    free(p);
+    return NULL;
+  }
+#endif
+
+  m4rie_file_header_t *h = (m4rie_file_header_t*)p;
+  if (!_m4rie_file_header_ok(h, ff, planes, len)) {
+    _m4rie_unmap(p, len);
+    return NULL;
+  }
+  return h;
+}
+
+FILE *_mzed_file_open(const char *filename, const gf2e *ff, rci_t *m, rci_t *n) {
+  FILE *fh = fopen(filename, "rb");
+  if (fh == NULL)
+    return NULL;
+  m4rie_file_header_t h;
+  long len = -1;
+  if (fread(&h, sizeof(m4rie_file_header_t), 1, fh) == 1 && fseek(fh, 0, SEEK_END) == 0)
+    len = ftell(fh);
+  if (len < 0 || !_m4rie_file_header_ok(&h, ff, 0, len)) {
+    fclose(fh);
+    return NULL;
+  }
+  *m = h.nrows;
+  *n = h.ncols;
+  return fh;
+}
+
+rci_t _mzed_file_read(FILE *fh, mzed_t *A, const rci_t m, const rci_t row) {
+  const wi_t width = A->x->width;
+  const wi_t rowstride = _m4rie_file_rowstride(width);
+  const rci_t k = MIN(A->nrows, m - row);
+  if (k <= 0)
+    return 0;
+  if (fseek(fh, sizeof(m4rie_file_header_t) + (long)row*rowstride*sizeof(word), SEEK_SET) != 0)
+    return -1;
+  for(rci_t i=0; i<k; i++) {
+    if (fread(A->x->rows[i], sizeof(word), width, fh) != (size_t)width)
+      return -1;
+    if (rowstride > width && fseek(fh, (rowstride - width)*sizeof(word), SEEK_CUR) != 0)
+      return -1;
+  }
+  return k;
+}
+
+/**
+ * The rows of mapped matrices are the mapped pages if M4RI allows it, see configure.ac.
+ */
+
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_M4RI_EXTERNAL_ROWS)
+#define __M4RIE_MAP_ROWS 1
+#endif
+
+#ifdef __M4RIE_MAP_ROWS
+
+/**
+ * An mzd_t whose rows point to data. This assumes the layout of mzd_t in M4RI:
+ *
+ * - mzd_init(m, 0) allocates the m row pointers but no blocks,
+ * - all functions access the entries through mzd_t::rows, mzd_t::rowstride, mzd_t::width and the
+ *   bitmasks and flags set below, i.e. never through mzd_t::blocks,
+ * - mzd_free() frees the row pointers and the blocks, hence leaves data alone.
+ *
+ * configure checks these assumptions and defines HAVE_M4RI_EXTERNAL_ROWS if they hold.
+ */
+
+static mzd_t *_mzd_init_mapped(word *data, const rci_t m, const rci_t n, const wi_t rowstride) {
+  mzd_t *A = mzd_init(m, 0);
+  A->ncols = n;
+  A->width = (n + m4ri_radix - 1)/m4ri_radix;
+  A->rowstride = rowstride;
+  A->high_bitmask = __M4RI_LEFT_BITMASK(n % m4ri_radix);
+  A->low_bitmask = m4ri_ffff;
+  A->flags = mzd_flag_windowed_zerooffset;
+  A->flags |= (n % m4ri_radix) ? mzd_flag_nonzero_excess : mzd_flag_windowed_zeroexcess;
+  for(rci_t i=0; i<m; i++)
+    A->rows[i] = data + (size_t)i*rowstride;
+  return A;
+}
+
+#else
+
+/**
+ * An ordinary mzd_t holding a copy of the rows in data.
+ */
+
+static mzd_t *_mzd_init_mapped(word *data, const rci_t m, const rci_t n, const wi_t rowstride) {
+  mzd_t *A = mzd_init(m, n);
+  for(rci_t i=0; i<m; i++)
+    memcpy(A->rows[i], data + (size_t)i*rowstride, A->width * sizeof(word));
+  return A;
+}
+
+#endif //__M4RIE_MAP_ROWS
+
+mzed_t *mzed_map_file(const gf2e *ff, const char *filename) {
+  m4rie_file_header_t *h = _m4rie_map_file(ff, filename, 0);
+  if (h == NULL)
+    return NULL;
+
+  const rci_t m = h->nrows, n = h->ncols;
+  if (m == 0) {
+    _m4rie_unmap(h, sizeof(m4rie_file_header_t));
+    return mzed_init(ff, 0, n);
+  }
+
+  mzed_t *A = (mzed_t *)m4ri_mm_malloc(sizeof(mzed_t));
+  A->finite_field = ff;
+  A->w = h->w;
+  A->kernels = mzed_kernels(ff, A->w);
+  A->nrows = m;
+  A->ncols = n;
+  A->x = _mzd_init_mapped((word*)(h + 1), m, A->w*n, h->rowstride);
+#ifndef __M4RIE_MAP_ROWS
+  _m4rie_unmap(h, sizeof(m4rie_file_header_t) + (size_t)m*h->rowstride*sizeof(word));
+#endif
+  return A;
+}
+
+void mzed_unmap_file(mzed_t *A) {
+#ifdef __M4RIE_MAP_ROWS
+  if (A->nrows) {
+    m4rie_file_header_t *h = (m4rie_file_header_t*)A->x->rows[0] - 1;
+    _m4rie_unmap(h, sizeof(m4rie_file_header_t) + (size_t)A->nrows*A->x->rowstride*sizeof(word));
+  }
+#endif
+  mzed_free(A);
+}
+
+mzd_slice_t *mzd_slice_map_file(const gf2e *ff, const char *filename) {
+  m4rie_file_header_t *h = _m4rie_map_file(ff, filename, ff->degree);
+  if (h == NULL)
+    return NULL;
+
+  const rci_t m = h->nrows, n = h->ncols;
+  if (m == 0) {
+    _m4rie_unmap(h, sizeof(m4rie_file_header_t));
+    return mzd_slice_init(ff, 0, n);
+  }
+
+  mzd_slice_t *A = (mzd_slice_t*)m4ri_mm_malloc(sizeof(mzd_slice_t));
+  A->finite_field = ff;
+  A->nrows = m;
+  A->ncols = n;
+  A->depth = ff->degree;
+  A->x = (mzd_t**)m4ri_mm_malloc(A->depth * sizeof(mzd_t*));
+  word *data = (word*)(h + 1);
+  for(int k=0; k<A->depth; k++)
+    A->x[k] = _mzd_init_mapped(data + (size_t)k*m*h->rowstride, m, n, h->rowstride);
+#ifndef __M4RIE_MAP_ROWS
+  _m4rie_unmap(h, sizeof(m4rie_file_header_t) + (size_t)A->depth*m*h->rowstride*sizeof(word));
+#endif
+  return A;
+}
+
+void mzd_slice_unmap_file(mzd_slice_t *A) {
+#ifdef __M4RIE_MAP_ROWS
+  if (A->nrows) {
+    m4rie_file_header_t *h = (m4rie_file_header_t*)A->x[0]->rows[0] - 1;
+    _m4rie_unmap(h, sizeof(m4rie_file_header_t) + (size_t)A->depth*A->nrows*A->x[0]->rowstride*sizeof(word));
+  }
+#endif
+  mzd_slice_free(A);
+}
@@ -0,0 +1,358 @@
+/**
+ * \file io.h
+ *
+ * \brief Reading and writing matrices over \GF2E as text and as binary files.
+ *
+ * Elements are written in hexadecimal as in mzed_print(), i.e. bit i of the integer is the
+ * coefficient of \f$a^i\f$. Rows are formatted word by word into a buffer which is written with a
+ * single call to fwrite() per block of rows; with OpenMP the rows of large matrices are formatted
+ * and parsed in parallel.
+ *
+ * Supported formats are
+ *
+ * - M4RIE_FORMAT_PLAIN, the output of mzed_print() and mzd_slice_print():
+ * \verbatim
+[ 1 a3]
+[ 0  7]
+\endverbatim
+ * - M4RIE_FORMAT_SAGE, a list of rows which Sage reads with e.g.
+ *   <tt>matrix(K, [[K.fetch_int(a) for a in row] for row in L])</tt>:
+ * \verbatim
+[[0x01, 0xa3],
+ [0x00, 0x07]]
+\endverbatim
+ * - M4RIE_FORMAT_MATRIX_MARKET, the Matrix Market coordinate format with decimal integer entries,
+ *   one-based indices and only the non-zero entries:
+ * \verbatim
+%%MatrixMarket matrix coordinate integer general
+% GF(2^8) modulus 0x11b
+2 2 3
+1 1 1
+1 2 163
+2 2 7
+\endverbatim
+ *
+ * When reading, elements may be separated by any mix of blanks and commas and the prefix 0x is
+ * optional. A Matrix Market modulus comment which does not match the field is an error.
+ *
+ * The binary format is a m4rie_file_header_t followed by the rows of the underlying mzd_t, i.e.
+ * the packed rows of an mzed_t or the mzd_slice_t::depth bit planes of an mzd_slice_t one after
+ * the other. Every row takes m4rie_file_header_t::rowstride words, hence the rows are 16-byte
+ * aligned as in M4RI and mzed_map_file() can use the mapped pages as rows without copying.
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+#ifndef M4RIE_IO_H
+#define M4RIE_IO_H
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <m4ri/m4ri.h>
+#include <m4rie/gf2e.h>
+#include <m4rie/mzed.h>
+#include <m4rie/mzd_slice.h>
+
+/**
+ * \brief Text formats, see io.h.
+ *
+ * \ingroup Definitions
+ */
+
+typedef enum {
+  M4RIE_FORMAT_PLAIN = 0,         /**< one bracketed row per line as mzed_print() */
+  M4RIE_FORMAT_SAGE = 1,          /**< nested list of hexadecimal integers */
+  M4RIE_FORMAT_MATRIX_MARKET = 2, /**< Matrix Market coordinate format */
+} m4rie_format_t;
+
+/**
+ * Rows are formatted and parsed in parallel if the matrix has more than this many elements.
+ */
+
+#define __M4RIE_IO_PARALLEL_CUTOFF (1<<16)
+
+/**
+ * mzed_fprint() formats blocks of rows of about this many bytes before writing them.
+ */
+
+#define __M4RIE_IO_BLOCK_SIZE (1<<20)
+
+/**
+ * \brief Return A as a string in the given format.
+ *
+ * \param A Matrix.
+ * \param format Text format.
+ *
+ * \return A string allocated with malloc() which the caller has to free().
+ *
+ * \ingroup StringConversions
+ */
+
+char *mzed_to_string(const mzed_t *A, const m4rie_format_t format);
+
+/**
+ * \brief Parse a matrix over ff from str.
+ *
+ * The dimensions are read from str.
+ *
+ * \param ff Finite field.
+ * \param str Null-terminated string.
+ * \param format Text format.
+ *
+ * \return A new matrix or NULL if str is malformed, rows differ in length or an element is not in
+ * ff.
+ *
+ * \ingroup StringConversions
+ */
+
+mzed_t *mzed_from_string(const gf2e *ff, const char *str, const m4rie_format_t format);
+
+/**
+ * \brief Write A to stream in the given format.
+ *
+ * \param stream Output stream.
+ * \param A Matrix.
+ * \param format Text format.
+ *
+ * \return 0 on success and -1 if writing failed.
+ *
+ * \ingroup StringConversions
+ */
+
+int mzed_fprint(FILE *stream, const mzed_t *A, const m4rie_format_t format);
+
+/**
+ * \brief Read a matrix over ff from the remainder of stream.
+ *
+ * \param stream Input stream.
+ * \param ff Finite field.
+ * \param format Text format.
+ *
+ * \return A new matrix or NULL, see mzed_from_string().
+ *
+ * \ingroup StringConversions
+ */
+
+mzed_t *mzed_fscan(FILE *stream, const gf2e *ff, const m4rie_format_t format);
+
+/**
+ * \brief Return A as a string in the given format, see mzed_to_string().
+ *
+ * \param A Bitsliced matrix.
+ * \param format Text format.
+ *
+ * \ingroup StringConversions
+ */
+
+char *mzd_slice_to_string(const mzd_slice_t *A, const m4rie_format_t format);
+
+/**
+ * \brief Parse a bitsliced matrix over ff from str, see mzed_from_string().
+ *
+ * \param ff Finite field.
+ * \param str Null-terminated string.
+ * \param format Text format.
+ *
+ * \ingroup StringConversions
+ */
+
+mzd_slice_t *mzd_slice_from_string(const gf2e *ff, const char *str, const m4rie_format_t format);
+
+/**
+ * \brief Write A to stream in the given format, see mzed_fprint().
+ *
+ * \param stream Output stream.
+ * \param A Bitsliced matrix.
+ * \param format Text format.
+ *
+ * \ingroup StringConversions
+ */
+
+int mzd_slice_fprint(FILE *stream, const mzd_slice_t *A, const m4rie_format_t format);
+
+/**
+ * \brief Read a bitsliced matrix over ff from stream, see mzed_fscan().
+ *
+ * \param stream Input stream.
+ * \param ff Finite field.
+ * \param format Text format.
+ *
+ * \ingroup StringConversions
+ */
+
+mzd_slice_t *mzd_slice_fscan(FILE *stream, const gf2e *ff, const m4rie_format_t format);
+
+/**
+ * \brief Version of the binary format written by mzed_write_file() and mzd_slice_write_file().
+ */
+
+#define M4RIE_FILE_VERSION 1
+
+/**
+ * \brief Header of the binary format, 64 bytes in host byte order.
+ *
+ * \ingroup Definitions
+ */
+
+typedef struct {
+  char magic[8];      /**< "M4RIEMAT" */
+  uint32_t version;   /**< M4RIE_FILE_VERSION */
+  uint32_t planes;    /**< 0 for an mzed_t, mzd_slice_t::depth for an mzd_slice_t */
+  uint64_t byteorder; /**< 0x0102030405060708 as written */
+  uint64_t minpoly;   /**< gf2e::minpoly */
+  int64_t nrows;      /**< Number of rows. */
+  int64_t ncols;      /**< Number of columns of the matrix over \GF2E. */
+  uint32_t degree;    /**< gf2e::degree */
+  uint32_t w;         /**< Bits per element, 1 for an mzd_slice_t. */
+  uint64_t rowstride; /**< Words per row. */
+} m4rie_file_header_t;
+
+/**
+ * \brief Write A to the file filename in the binary format.
+ *
+ * \param A Matrix.
+ * \param filename File name.
+ *
+ * \return 0 on success and -1 if writing failed.
+ *
+ * \ingroup StringConversions
+ */
+
+int mzed_write_file(const mzed_t *A, const char *filename);
+
+/**
+ * \brief Create the file filename for an m x n matrix over ff in the binary format and write its
+ * header.
+ *
+ * The rows have to be appended with _mzed_file_append() before the file is closed.
+ *
+ * \param filename File name.
+ * \param ff Finite field.
+ * \param m Number of rows.
+ * \param n Number of columns.
+ *
+ * \return The open file or NULL.
+ */
+
+FILE *_mzed_file_create(const char *filename, const gf2e *ff, const rci_t m, const rci_t n);
+
+/**
+ * \brief Append the rows of A to a file created with _mzed_file_create().
+ *
+ * \param fh File.
+ * \param A Matrix over the field of the file with as many columns.
+ *
+ * \return 0 on success and -1 if writing failed.
+ */
+
+int _mzed_file_append(FILE *fh, const mzed_t *A);
+
+/**
+ * \brief Open a file written by mzed_write_file() for reading its rows with _mzed_file_read().
+ *
+ * \param filename File name.
+ * \param ff Finite field.
+ * \param m Set to the number of rows.
+ * \param n Set to the number of columns.
+ *
+ * \return The open file or NULL if it cannot be read or does not match ff.
+ */
+
+FILE *_mzed_file_open(const char *filename, const gf2e *ff, rci_t *m, rci_t *n);
+
+/**
+ * \brief Read the rows row, row+1, ... of the m x n matrix in a file opened with
+ * _mzed_file_open() into A.
+ *
+ * \param fh File.
+ * \param A Matrix with n columns, its rows are overwritten.
+ * \param m Number of rows in the file.
+ * \param row Index of the first row to read.
+ *
+ * \return The number of rows read, i.e. MIN(A->nrows, m - row), or -1 if reading failed.
+ */
+
+rci_t _mzed_file_read(FILE *fh, mzed_t *A, const rci_t m, const rci_t row);
+
+/**
+ * \brief Map a matrix over ff written by mzed_write_file().
+ *
+ * The rows of the returned matrix are the mapped pages of the file. They are shared with other
+ * processes mapping the same file until they are written to, changes are never written back. If
+ * mmap() is not available or configure found that M4RI matrices cannot use rows they do not own,
+ * the rows are read into an ordinary matrix instead.
+ *
+ * \param ff Finite field, must match the one recorded in the file.
+ * \param filename File name.
+ *
+ * \return A matrix which must be freed with mzed_unmap_file() or NULL if the file cannot be read,
+ * is not of the current version, was written on a machine with a different byte order or for a
+ * different field.
+ *
+ * \ingroup StringConversions
+ */
+
+mzed_t *mzed_map_file(const gf2e *ff, const char *filename);
+
+/**
+ * \brief Free a matrix returned by mzed_map_file().
+ *
+ * \param A Matrix.
+ *
+ * \ingroup StringConversions
+ */
+
+void mzed_unmap_file(mzed_t *A);
+
+/**
+ * \brief Write A to the file filename in the binary format, see mzed_write_file().
+ *
+ * \param A Bitsliced matrix.
+ * \param filename File name.
+ *
+ * \ingroup StringConversions
+ */
+
+int mzd_slice_write_file(const mzd_slice_t *A, const char *filename);
+
+/**
+ * \brief Map a bitsliced matrix over ff written by mzd_slice_write_file(), see mzed_map_file().
+ *
+ * \param ff Finite field, must match the one recorded in the file.
+ * \param filename File name.
+ *
+ * \ingroup StringConversions
+ */
+
+mzd_slice_t *mzd_slice_map_file(const gf2e *ff, const char *filename);
+
+/**
+ * \brief Free a matrix returned by mzd_slice_map_file().
+ *
+ * \param A Bitsliced matrix.
+ *
+ * \ingroup StringConversions
+ */
+
+void mzd_slice_unmap_file(mzd_slice_t *A);
+
+#endif //M4RIE_IO_H
@@ -73,7 +73,10 @@ extern "C" {
 #endif //__cplusplus
 
 #include <m4rie/gf2e.h>
+#include <m4rie/gf2e_simd.h>
+#include <m4rie/dispatch.h>
 #include <m4rie/mzed.h>
+#include <m4rie/mzes.h>
 #include <m4rie/newton_john.h>
 #include <m4rie/echelonform.h>
 #include <m4rie/strassen.h>
@@ -83,6 +86,10 @@ extern "C" {
 #include <m4rie/conversion.h>
 #include <m4rie/permutation.h>
 #include <m4rie/mzd_poly.h>
+#include <m4rie/tower.h>
+#include <m4rie/random.h>
+#include <m4rie/io.h>
+#include <m4rie/stream.h>
 
 #ifdef __cplusplus
 }
@@ -72,6 +72,69 @@ void _poly_addmul4(mzd_t **c, const mzd_t **a, const mzd_t **b) {
   mzd_free(t0[0]); mzd_free(t0[1]); mzd_free(t0[2]);
 }
 
+void _poly_addmul_karatsuba(mzd_t **c, const mzd_t **a, const mzd_t **b, const unsigned int n) {
+  switch(n) {
+  case 1:
+    mzd_addmul(c[0], a[0], b[0], 0);
+    return;
+  case 2:
+    _poly_addmul2(c, a, b);
+    return;
+  case 4:
+    _poly_addmul4(c, a, b);
+    return;
+  default:
+    break;
+  }
+
+  /* a = a0 + a1*X^h with h coefficients in a0 and l <= h coefficients in a1 */
+  const unsigned int h = (n+1)/2;
+  const unsigned int l = n - h;
+
+  const rci_t m = a[0]->nrows;
+  const rci_t p = b[0]->ncols;
+
+  const mzd_t **sa = (const mzd_t**)m4ri_mm_malloc(h * sizeof(mzd_t*));
+  const mzd_t **sb = (const mzd_t**)m4ri_mm_malloc(h * sizeof(mzd_t*));
+  mzd_t **t = (mzd_t**)m4ri_mm_malloc((2*h-1) * sizeof(mzd_t*));
+
+  /* + (a0+a1)(b0+b1)X^h */
+  for(unsigned int i=0; i<h; i++) {
+    if (i < l) {
+      sa[i] = mzd_add(NULL, a[i], a[h+i]);
+      sb[i] = mzd_add(NULL, b[i], b[h+i]);
+    } else {
+      sa[i] = a[i];
+      sb[i] = b[i];
+    }
+  }
+  _poly_addmul_karatsuba(c + h, sa, sb, h);
+  for(unsigned int i=0; i<l; i++) {
+    mzd_free((mzd_t*)sa[i]);
+    mzd_free((mzd_t*)sb[i]);
+  }
+
+  /* + a0b0(1-X^h) */
+  for(unsigned int i=0; i<2*h-1; i++)
+    t[i] = mzd_init(m, p);
+  _poly_addmul_karatsuba(t, a, b, h);
+  _poly_add(c,     (const mzd_t**)c,     (const mzd_t**)t, 2*h-1);
+  _poly_add(c + h, (const mzd_t**)c + h, (const mzd_t**)t, 2*h-1);
+
+  /* + a1b1(X^h+X^2h) */
+  for(unsigned int i=0; i<2*l-1; i++)
+    mzd_set_ui(t[i], 0);
+  _poly_addmul_karatsuba(t, a + h, b + h, l);
+  _poly_add(c + h,   (const mzd_t**)c + h,   (const mzd_t**)t, 2*l-1);
+  _poly_add(c + 2*h, (const mzd_t**)c + 2*h, (const mzd_t**)t, 2*l-1);
+
+  for(unsigned int i=0; i<2*h-1; i++)
+    mzd_free(t[i]);
+  m4ri_mm_free(t);
+  m4ri_mm_free(sa);
+  m4ri_mm_free(sb);
+}
+
 static inline mzd_slice_t * mzd_slice_addmul_mzd(mzd_slice_t *C, const word a, const mzd_t *A) {
   for(int i=0; i<C->depth; i++)
     if(a & 1ULL<<i)
@@ -84,7 +147,7 @@ mzd_poly_t *_mzd_poly_addmul1(mzd_poly_t *C, mzd_poly_t *A, mzd_poly_t *B) {
   const int log2d = (int)ceil(log2( (double)d ));
   assert(log2d <= 16);
 
-  gf2e *ff = gf2e_init(irreducible_polynomials[log2d][1]);
+  const gf2e *ff = gf2e_get(irreducible_polynomials[log2d][1]);
 
   mzd_slice_t  *a = mzd_slice_init(ff, A->nrows, A->ncols);
   mzd_slice_t  *b = mzd_slice_init(ff, B->nrows, B->ncols);
@@ -144,6 +207,6 @@ mzd_poly_t *_mzd_poly_addmul1(mzd_poly_t *C, mzd_poly_t *A, mzd_poly_t *B) {
 
   mzed_free(Phi);
   mzed_free(Rho);
-  gf2e_free(ff);
+  gf2e_release(ff);
   return C;
 }
@@ -72,6 +72,17 @@ static inline void _poly_add(mzd_t **c, const mzd_t **a, const mzd_t **b,const u
 void _poly_addmul2(mzd_t **X, const mzd_t **a, const mzd_t **b);
 void _poly_addmul4(mzd_t **X, const mzd_t **a, const mzd_t **b);
 
+/**
+ * \brief c += a*b for polynomials a, b with n coefficients using recursive Karatsuba.
+ *
+ * \param c Polynomial with 2n-1 coefficients.
+ * \param a Polynomial with n coefficients.
+ * \param b Polynomial with n coefficients.
+ * \param n Integer > 0.
+ */
+
+void _poly_addmul_karatsuba(mzd_t **c, const mzd_t **a, const mzd_t **b, const unsigned int n);
+
 /*********************************************************************
  * mzd_poly_t will be the data type for matrices over GF(2)[x] in the
  * future
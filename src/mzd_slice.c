@@ -19,6 +19,7 @@
 
 #include "mzd_slice.h"
 #include "m4ri_functions.h"
+#include "io.h"
 
 /**
  * \brief Add A to coefficient of X^t but perform modular reductions on the fly.
@@ -43,7 +44,7 @@ static inline void mzd_add_modred(const gf2e *ff, const mzd_t *A, mzd_t **X, con
   word pow_gen = ff->pow_gen[t];
 
   for(int i=0; i<ff->degree; i++) {
-    if (pow_gen & (1<<i))
+    if (pow_gen & __M4RI_TWOPOW(i))
        mzd_add(X[i],X[i],A);
   }
 }
@@ -80,7 +81,7 @@ mzd_slice_t *mzd_slice_mul_scalar(mzd_slice_t *C, const word a, const mzd_slice_
   const gf2e *ff = B->finite_field;
 
   for(int i=0; i<ff->degree; i++) {
-    if(a&(1<<i)) {
+    if(a & __M4RI_TWOPOW(i)) {
       for(int j=0; j<B->depth; j++)
         mzd_add_modred(ff, B->x[j], C->x, i+j);
     }
@@ -94,7 +95,7 @@ mzd_slice_t *mzd_slice_addmul_scalar(mzd_slice_t *C, const word a, const mzd_sli
   const gf2e *ff = B->finite_field;
 
   for(int i=0; i<ff->degree; i++) {
-    if(a&(1<<i)) {
+    if(a & __M4RI_TWOPOW(i)) {
       for(int j=0; j<B->depth; j++)
         mzd_add_modred(ff, B->x[j], C->x, i+j);
     }
@@ -109,22 +110,7 @@ void mzd_slice_set_ui(mzd_slice_t *A, word value) {
 }
 
 void mzd_slice_print(const mzd_slice_t *A) {
-  char formatstr[10];
-  int width = gf2e_degree_to_w(A->finite_field)/4;
-  if (gf2e_degree_to_w(A->finite_field)%4)
-    width += 1;
-  sprintf(formatstr,"%%%dx",width);
-
-  for (rci_t i=0; i < A->nrows; ++i) {
-    printf("[");
-    for (rci_t j=0; j < A->ncols; j++) {
-      word tmp = mzd_slice_read_elem(A,i,j);
-      printf(formatstr,(int)tmp);
-      if(j<A->ncols-1)
-        printf(" ");
-    }
-    printf("]\n");
-  }
+  mzd_slice_fprint(stdout, A, M4RIE_FORMAT_PLAIN);
 }
 
 mzd_slice_t *_mzd_slice_mul_naive(mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B) {
@@ -145,6 +131,26 @@ mzd_slice_t *_mzd_slice_mul_naive(mzd_slice_t *C, const mzd_slice_t *A, const mz
   return C;
 }
 
+mzd_slice_t *_mzd_slice_mul_karatsuba_generic(mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B) {
+  if (C == NULL)
+    C = mzd_slice_init(A->finite_field, A->nrows, B->ncols);
+
+  const unsigned int e = A->finite_field->degree;
+
+  mzd_t **t = (mzd_t**)m4ri_mm_malloc((2*e-1) * sizeof(mzd_t*));
+  for(unsigned int i=0; i<2*e-1; i++)
+    t[i] = mzd_init(A->nrows, B->ncols);
+
+  _poly_addmul_karatsuba(t, (const mzd_t**)A->x, (const mzd_t**)B->x, e);
+
+  for(unsigned int i=0; i<2*e-1; i++) {
+    mzd_add_modred(A->finite_field, t[i], C->x, i);
+    mzd_free(t[i]);
+  }
+  m4ri_mm_free(t);
+  return C;
+}
+
 mzd_slice_t *_mzd_slice_mul_karatsuba2(mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B) {
   // two temporaries
   if (C == NULL)
@@ -53,7 +53,7 @@
  */
 
 typedef struct {
-  mzd_t *x[16]; /**< mzd_slice_t::x[e][i,j] is the \e-th bit of the entry A[i,j]. */
+  mzd_t **x; /**< mzd_slice_t::x[e][i,j] is the \e-th bit of the entry A[i,j], depth entries. */
   rci_t nrows; /**< Number of rows. */
   rci_t ncols; /**< Number of columns. */
   unsigned int depth;   /**< Number of slices                *
@@ -82,6 +82,7 @@ static inline mzd_slice_t *mzd_slice_init(const gf2e *ff, const rci_t m, const r
   A->ncols = n;
   A->depth = ff->degree;
 
+  A->x = (mzd_t**)m4ri_mm_malloc(A->depth * sizeof(mzd_t*));
   for(int i=0; i<A->depth; i++)
     A->x[i] = mzd_init(m,n);
   return A;
@@ -123,10 +124,15 @@ static inline mzd_slice_t *_mzd_slice_adapt_depth(mzd_slice_t *A, const unsigned
       mzd_free(A->x[i]);
       A->x[i] = NULL;
     }
-  } else {
+  } else if (new_depth > A->depth) {
+    mzd_t **x = (mzd_t**)m4ri_mm_malloc(new_depth * sizeof(mzd_t*));
+    for(unsigned int i=0; i<A->depth; i++)
+      x[i] = A->x[i];
     for(unsigned int i=A->depth; i<new_depth; i++) {
-      A->x[i] = mzd_init(A->nrows,A->ncols);
+      x[i] = mzd_init(A->nrows,A->ncols);
     }
+    m4ri_mm_free(A->x);
+    A->x = x;
   }
   A->depth = new_depth;
   return A;
@@ -144,6 +150,7 @@ static inline mzd_slice_t *_mzd_slice_adapt_depth(mzd_slice_t *A, const unsigned
 static inline void mzd_slice_free(mzd_slice_t *A) {
   for(int i=0; i<A->depth; i++)
    mzd_free(A->x[i]);
+  m4ri_mm_free(A->x);
 #if __M4RI_USE_MM_MALLOC
   _mm_free(A);
 #else
@@ -260,6 +267,7 @@ static inline mzd_slice_t *mzd_slice_init_window(const mzd_slice_t *A,
   B->depth = A->depth;
   B->nrows = highr - lowr;
   B->ncols = highc - lowc;
+  B->x = (mzd_t**)m4ri_mm_malloc(A->depth * sizeof(mzd_t*));
   for(int i=0; i<A->depth; i++) {
     B->x[i] = mzd_init_window(A->x[i], lowr, lowc, highr, highc);
   }
@@ -278,6 +286,7 @@ static inline void mzd_slice_free_window(mzd_slice_t *A) {
   for(int i=0; i<A->depth; i++) {
     mzd_free_window(A->x[i]);
   }
+  m4ri_mm_free(A->x);
   m4ri_mm_free(A);
 }
 
@@ -360,6 +369,23 @@ static inline mzd_slice_t *mzd_slice_add(mzd_slice_t *C, const mzd_slice_t *A, c
 
 mzd_slice_t *_mzd_slice_mul_naive(mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B);
 
+/**
+ * \brief \f$ C = A \cdot B \f$ using recursive Karatsuba multiplication of the slices and
+ * modular reduction of the product.
+ *
+ * Computes about \f$e^{1.58}\f$ products over \GF2 for any degree \e and is used for \f$e > 8\f$.
+ *
+ * \param C Preallocated return matrix, may be NULL for automatic creation.
+ * \param A Input matrix A.
+ * \param B Input matrix B.
+ *
+ * \sa _mzd_slice_mul_karatsuba()
+ *
+ * \ingroup Multiplication
+ */
+
+mzd_slice_t *_mzd_slice_mul_karatsuba_generic(mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B);
+
 /**
  * \brief \f$ C = A \cdot B \f$ over \GF4 using 3 multiplications over \GF2 and 2 temporary \GF2 matrices..
  *
@@ -519,7 +545,7 @@ static inline mzd_slice_t *_mzd_slice_mul_karatsuba(mzd_slice_t *C, const mzd_sl
   case  7: C = _mzd_slice_mul_karatsuba7(C, A, B); break;
   case  8: C = _mzd_slice_mul_karatsuba8(C, A, B); break;
   default:
-    C = _mzd_slice_mul_naive(C, A, B); break;
+    C = _mzd_slice_mul_karatsuba_generic(C, A, B); break;
   }
   return C;
 }
@@ -626,18 +652,32 @@ static inline mzd_slice_t *mzd_slice_addmul(mzd_slice_t *C, const mzd_slice_t *A
 }
 
 /**
- * \brief Fill matrix A with random elements.
+ * \brief Fill matrix A with random elements from rng.
  *
  * \param A Matrix
+ * \param rng Random number generator, e.g. m4rie_prng_next(). If NULL m4rie_random_libc() is used.
+ * \param state State passed to rng.
+ *
+ * \ingroup Assignment
+ */
+
+static inline void mzd_slice_randomize_rng(mzd_slice_t *A, m4rie_random_t rng, void *state) {
+  for(int i=0; i<A->depth; i++)
+    _mzd_randomize_masked(A->x[i], m4ri_ffff, rng, state);
+}
+
+/**
+ * \brief Fill matrix A with random elements.
+ *
+ * Uses random(), see mzd_slice_randomize_rng() for other generators.
  *
- * \todo Allow the user to provide a RNG callback.
+ * \param A Matrix
  *
  * \ingroup Assignment
  */
 
 static inline void mzd_slice_randomize(mzd_slice_t *A) {
-  for(int i=0; i<A->depth; i++)
-    mzd_randomize(A->x[i]);
+  mzd_slice_randomize_rng(A, NULL, NULL);
 }
 
 /**
@@ -659,6 +699,26 @@ static inline mzd_slice_t *mzd_slice_copy(mzd_slice_t *B, const mzd_slice_t *A)
   return B;
 }
 
+/**
+ * \brief Return the transpose of A, every slice is transposed by M4RI.
+ *
+ * \param C Preallocated matrix with A->ncols rows and A->nrows columns, different from A, or NULL.
+ * \param A Matrix.
+ *
+ * \ingroup Assignment
+ */
+
+static inline mzd_slice_t *mzd_slice_transpose(mzd_slice_t *C, const mzd_slice_t *A) {
+  if (C == NULL)
+    C = mzd_slice_init(A->finite_field, A->ncols, A->nrows);
+  else if (C->finite_field != A->finite_field || C->nrows != A->ncols || C->ncols != A->nrows)
+    m4ri_die("mzd_slice_transpose: rows and columns of returned matrix must match.\n");
+
+  for(int i=0; i<A->depth; i++)
+    mzd_transpose(C->x[i], A->x[i]);
+  return C;
+}
+
 /**
  * \brief Get the element at position (row,col) from the matrix A.
  *
@@ -674,7 +734,7 @@ static inline mzd_slice_t *mzd_slice_copy(mzd_slice_t *B, const mzd_slice_t *A)
 static inline word mzd_slice_read_elem(const mzd_slice_t *A, const rci_t row, const rci_t col) {
   word ret = 0;
   for(int i=0; i<A->depth; i++) {
-    ret |= mzd_read_bit(A->x[i], row, col)<<i;
+    ret |= (word)mzd_read_bit(A->x[i], row, col)<<i;
   }
   return ret;
 }
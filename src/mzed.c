@@ -18,18 +18,21 @@
 ******************************************************************************/
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "config.h"
 #include "mzed.h"
 #include "strassen.h"
 #include "mzd_slice.h"
 #include "conversion.h"
+#include "io.h"
 
 mzed_t *mzed_init(const gf2e* k, rci_t m, rci_t n) {
   mzed_t *A = (mzed_t *)m4ri_mm_malloc(sizeof(mzed_t));
 
   A->finite_field = k;
   A->w = gf2e_degree_to_w(A->finite_field);
+  A->kernels = mzed_kernels(A->finite_field, A->w);
   A->nrows = m;
   A->ncols = n;
   A->x = mzd_init(m, A->w*n);
@@ -42,12 +45,100 @@ void mzed_free(mzed_t *A) {
 }
 
 void mzed_randomize(mzed_t *A) {
-  unsigned int bitmask = (1<<A->finite_field->degree)-1;
-  for(rci_t r=0; r<A->nrows; r++) {
-    for(rci_t c=0; c<A->ncols; c++) {
-      mzed_write_elem(A,r,c, random()&bitmask);
+  mzed_randomize_rng(A, NULL, NULL);
+}
+
+void mzed_randomize_rng(mzed_t *A, m4rie_random_t rng, void *state) {
+  /** the elements are aligned to A->w in every word, also in windows **/
+  word mask = 0;
+  for(int k=0; k<m4ri_radix; k+=A->w)
+    mask |= __M4RI_LEFT_BITMASK(A->finite_field->degree) << k;
+  _mzd_randomize_masked(A->x, mask, rng, state);
+}
+
+/**
+ * A random non-zero element.
+ */
+
+static inline word _mzed_random_unit(const gf2e *ff, m4rie_random_t rng, void *state) {
+  word x;
+  do {
+    x = rng(state) & __M4RI_LEFT_BITMASK(ff->degree);
+  } while(x == 0);
+  return x;
+}
+
+/**
+ * Clear the elements in columns [0, c) of row r of A, which has offset zero.
+ */
+
+static inline void _mzed_clear_prefix(mzed_t *A, const rci_t r, const rci_t c) {
+  const rci_t b = A->w * c;
+  word *row = A->x->rows[r];
+  for(wi_t j=0; j<b/m4ri_radix; j++)
+    row[j] = 0;
+  if (b%m4ri_radix)
+    row[b/m4ri_radix] &= ~__M4RI_LEFT_BITMASK(b%m4ri_radix);
+}
+
+/**
+ * Clear the elements in columns [c, ncols) of row r of A, which has offset zero.
+ */
+
+static inline void _mzed_clear_suffix(mzed_t *A, const rci_t r, const rci_t c) {
+  const rci_t b = A->w * c;
+  word *row = A->x->rows[r];
+  wi_t j = b/m4ri_radix;
+  if (b%m4ri_radix)
+    row[j++] &= __M4RI_LEFT_BITMASK(b%m4ri_radix);
+  for(; j<A->x->width; j++)
+    row[j] = 0;
+}
+
+void mzed_randomize_rank(mzed_t *A, const rci_t r, m4rie_random_t rng, void *state) {
+  assert(A->x->offset == 0);
+  if (r > MIN(A->nrows, A->ncols))
+    m4ri_die("mzed_randomize_rank: rank %d exceeds the dimensions.\n", (int)r);
+  if (rng == NULL)
+    rng = m4rie_random_libc;
+
+  const gf2e *ff = A->finite_field;
+  if (r == 0) {
+    mzed_set_ui(A, 0);
+    return;
+  }
+
+  /** U: pivots in r out of n columns by selection sampling, zero before and random after **/
+  mzed_t *U = mzed_init(ff, r, A->ncols);
+  mzed_randomize_rng(U, rng, state);
+  rci_t i = 0;
+  for(rci_t c=0; c<A->ncols && i<r; c++) {
+    if ((rci_t)(rng(state) % (A->ncols - c)) < r - i) {
+      _mzed_clear_prefix(U, i, c);
+      mzed_write_elem(U, i, c, _mzed_random_unit(ff, rng, state));
+      i++;
     }
   }
+
+  /** L: ones on the diagonal, zero above and random below **/
+  mzed_t *L = mzed_init(ff, A->nrows, r);
+  mzed_randomize_rng(L, rng, state);
+  for(i=0; i<r; i++) {
+    _mzed_clear_suffix(L, i, i);
+    mzed_write_elem(L, i, i, 1);
+  }
+  for(i=A->nrows-1; i>0; i--)
+    mzed_row_swap(L, i, rng(state) % (i+1));
+
+  mzed_mul(A, L, U);
+  mzed_free(L);
+  mzed_free(U);
+}
+
+void mzed_randomize_invertible(mzed_t *A, m4rie_random_t rng, void *state) {
+  if (A->nrows != A->ncols)
+    m4ri_die("mzed_randomize_invertible: matrix must be square.\n");
+  mzed_randomize_rank(A, A->nrows, rng, state);
 }
 
 mzed_t *mzed_add(mzed_t *C, const mzed_t *A, const mzed_t *B) {
@@ -101,7 +192,7 @@ mzed_t *mzed_addmul(mzed_t *C, const mzed_t *A, const mzed_t *B) {
 }
 
 mzed_t *_mzed_mul(mzed_t *C, const mzed_t *A, const mzed_t *B) {
-  if (A->nrows >= 512 && A->ncols >= 512 && B->ncols >= 512)
+  if (_mzed_mul_use_karatsuba(A->finite_field, A->nrows, A->ncols, B->ncols))
     return _mzed_mul_karatsuba(C, A, B);
 
   const rci_t cutoff = _mzed_strassen_cutoff(C, A, B);
@@ -110,7 +201,7 @@ mzed_t *_mzed_mul(mzed_t *C, const mzed_t *A, const mzed_t *B) {
 
 mzed_t *_mzed_addmul(mzed_t *C, const mzed_t *A, const mzed_t *B) {
   assert((A->x->offset | B->x->offset | C->x->offset) == 0);
-  if (A->nrows >= 512 && A->ncols >= 512 && B->ncols >= 512)
+  if (_mzed_mul_use_karatsuba(A->finite_field, A->nrows, A->ncols, B->ncols))
     return _mzed_mul_karatsuba(C, A, B);
 
   const rci_t cutoff = _mzed_strassen_cutoff(C, A, B);
@@ -129,6 +220,23 @@ mzed_t *mzed_addmul_naive(mzed_t *C, const mzed_t *A, const mzed_t *B) {
 
 mzed_t *_mzed_mul_naive(mzed_t *C, const mzed_t *A, const mzed_t *B) {
   const gf2e* ff = C->finite_field;
+  if (C->ncols == 0 || A->ncols == 0)
+    return C;
+  if (C->x->offset == B->x->offset) {
+    /** C[i] += A[i,k]*B[k] using the row kernels **/
+    rci_t *rows = (rci_t*)m4ri_mm_malloc(A->ncols * sizeof(rci_t));
+    word *scalars = (word*)m4ri_mm_malloc(A->ncols * sizeof(word));
+    for (rci_t k=0; k<A->ncols; ++k)
+      rows[k] = k;
+    for (rci_t i=0; i<C->nrows; ++i) {
+      for (rci_t k=0; k<A->ncols; ++k)
+        scalars[k] = mzed_read_elem(A, i, k);
+      mzed_add_multiple_of_rows(C, i, B, rows, scalars, A->ncols, 0);
+    }
+    m4ri_mm_free(rows);
+    m4ri_mm_free(scalars);
+    return C;
+  }
   for (rci_t i=0; i<C->nrows; ++i) {
     for (rci_t j=0; j<C->ncols; ++j) {
       for (rci_t k=0; k<A->ncols; ++k) {
@@ -140,6 +248,21 @@ mzed_t *_mzed_mul_naive(mzed_t *C, const mzed_t *A, const mzed_t *B) {
 }
 
 
+/**
+ * a*v for a word v of packed elements, mul is from gf2e_mul_table_get().
+ */
+
+static inline word _mzed_mul_table_word(const word *mul, const unsigned int degree, const word v) {
+  const word mask_8 = (1<<8)-1;
+  const word mask_16 = (1<<16)-1;
+  if (degree <= 8)
+    return mul[v>>48 & mask_16]<<48 | mul[v>>32 & mask_16]<<32 | mul[v>>16 & mask_16]<<16 | mul[v & mask_16];
+
+  const word *mul_hi = mul + 256;
+  return (mul[v>>48 & mask_8] ^ mul_hi[v>>56 & mask_8])<<48 | (mul[v>>32 & mask_8] ^ mul_hi[v>>40 & mask_8])<<32
+    |    (mul[v>>16 & mask_8] ^ mul_hi[v>>24 & mask_8])<<16 | (mul[v     & mask_8] ^ mul_hi[v>> 8 & mask_8]);
+}
+
 mzed_t *mzed_mul_scalar(mzed_t *C, const word a, const mzed_t *B) {
   /**
    * The algorithm proceeds as follows:
@@ -150,10 +273,30 @@ mzed_t *mzed_mul_scalar(mzed_t *C, const word a, const mzed_t *B) {
   const gf2e *ff = B->finite_field;
 
   /**
-   * 0) If a direct approach would need less lookups we use that.
+   * 0) If vector instructions are available we build their tables once and process whole rows.
    */
 
-  if(ff->degree > 8 || B->nrows*B->ncols < 1<<17) {
+  if(gf2e_simd_available() && B->w <= 16 && B->x->offset == 0 && C->x->offset == 0 && B->x->width > __M4RIE_SIMD_CUTOFF) {
+    gf2e_simd_tab_t T;
+    gf2e_simd_tab_init(&T, ff, B->w, a);
+    const wi_t last = B->x->width - 1;
+    const word mask_end = B->x->high_bitmask;
+    for(rci_t i=0; i<B->nrows; i++) {
+      word *c_row = C->x->rows[i];
+      const word *b_row = B->x->rows[i];
+      word tmp;
+      _gf2e_simd_mul(c_row, b_row, last, &T, 0);
+      _gf2e_simd_mul(&tmp, b_row + last, 1, &T, 0);
+      c_row[last] = (c_row[last] & ~mask_end) | (tmp & mask_end);
+    }
+    return C;
+  }
+
+  /**
+   * 1) If a direct approach would need less lookups we use that.
+   */
+
+  if(ff->degree > 16 || B->nrows*B->ncols < __M4RIE_MUL_TABLE_CUTOFF) {
     mzed_copy(C, B);
     for(rci_t i=0; i<B->nrows; i++)
       mzed_rescale_row(C, i, 0, a);
@@ -161,36 +304,27 @@ mzed_t *mzed_mul_scalar(mzed_t *C, const word a, const mzed_t *B) {
   }
 
   /**
-   * 1) We generate a lookup table of 16-bit wide entries
+   * 2) We fetch a lookup table of 16-bit wide entries for e <= 8 or two of 8-bit wide entries for
+   *    e <= 16 from the cache.
    */
-  const word mask_16 = (1<<16)-1;
-  const word *mul = (const word*)gf2e_t16_init(B->finite_field, a);
+
+  const word *mul = gf2e_mul_table_get(ff, a);
 
   /**
-   * 2) We use that lookup table to do 4 lookups per word
+   * 3) We use that lookup table to do 4 (or 8) lookups per word
    */
 
   for(rci_t i=0; i<C->nrows; i++) {
     word *c_row = C->x->rows[i];
     const word *b_row = B->x->rows[i];
-    for(wi_t j=0; j<C->x->width-1; j++) {
-      const word tmp = b_row[j];
-      const word a0 = tmp & mask_16;
-      const word a1 = tmp>>16 & mask_16;
-      const word a2 = tmp>>32 & mask_16;
-      const word a3 = tmp>>48 & mask_16;
-      c_row[j] = mul[a3]<<48 | mul[a2]<<32 | mul[a1]<<16 | mul[a0];      
-    }
+    for(wi_t j=0; j<C->x->width-1; j++)
+      c_row[j] = _mzed_mul_table_word(mul, ff->degree, b_row[j]);
     /* deal with rest */
     const word tmp = b_row[B->x->width-1] & B->x->high_bitmask;
-    const word a0 = tmp & mask_16;
-    const word a1 = tmp>>16 & mask_16;
-    const word a2 = tmp>>32 & mask_16;
-    const word a3 = tmp>>48 & mask_16;
     c_row[C->x->width-1] &= ~B->x->high_bitmask;
-    c_row[C->x->width-1] |= mul[a3]<<48 | mul[a2]<<32 | mul[a1]<<16 | mul[a0];
+    c_row[C->x->width-1] |= _mzed_mul_table_word(mul, ff->degree, tmp);
   }
-  gf2e_t16_free((word*)mul);
+  gf2e_mul_table_release(mul);
   return C;
 }
 
@@ -207,6 +341,95 @@ mzed_t *mzed_copy(mzed_t *A, const mzed_t *B) {
   return A;
 }
 
+/**
+ * Rows of A are transposed in strips of e = m4ri_radix/w rows. The words of a strip form e x e
+ * tiles of elements which are transposed in log2(e) rounds, in round s elements (i, k+s) and
+ * (i+s, k) with i & s == 0 and k & s == 0 are swapped with one shift, xor and mask per pair of
+ * words. The words of __M4RIE_TRANSPOSE_BLOCK tiles are kept in rows of a buffer so that every
+ * round is a loop over consecutive words.
+ */
+
+#define __M4RIE_TRANSPOSE_BLOCK 64
+
+static void _mzed_transpose(mzed_t *C, const mzed_t *A) {
+  const int w = A->w;
+  const int e = m4ri_radix/w;
+  const wi_t width = A->x->width;
+
+  word mask[6];
+  for(int j=0, s=e/2; s>=1; j++, s/=2) {
+    mask[j] = 0;
+    for(int k=0; k<e; k++)
+      if ((k & s) == 0)
+        mask[j] |= __M4RI_LEFT_BITMASK(w) << (k*w);
+  }
+
+  word *t = (word*)m4ri_mm_malloc(e * __M4RIE_TRANSPOSE_BLOCK * sizeof(word));
+
+  for(rci_t r=0; r<A->nrows; r+=e) {
+    const int h = MIN(e, A->nrows - r);
+    for(wi_t b=0; b<width; b+=__M4RIE_TRANSPOSE_BLOCK) {
+      const int nb = MIN(__M4RIE_TRANSPOSE_BLOCK, width - b);
+
+      for(int i=0; i<e; i++) {
+        word *ti = t + i*__M4RIE_TRANSPOSE_BLOCK;
+        if (i < h) {
+          memcpy(ti, A->x->rows[r+i] + b, nb * sizeof(word));
+          if (b + nb == width)
+            ti[nb-1] &= A->x->high_bitmask;
+        } else {
+          memset(ti, 0, nb * sizeof(word));
+        }
+      }
+
+      for(int j=0, s=e/2; s>=1; j++, s/=2) {
+        const int shift = s*w;
+        const word m = mask[j];
+        for(int i=0; i<e; i++) {
+          if (i & s)
+            continue;
+          word *x0 = t + i*__M4RIE_TRANSPOSE_BLOCK;
+          word *x1 = t + (i+s)*__M4RIE_TRANSPOSE_BLOCK;
+          for(int u=0; u<nb; u++) {
+            const word d = ((x0[u] >> shift) ^ x1[u]) & m;
+            x1[u] ^= d;
+            x0[u] ^= d << shift;
+          }
+        }
+      }
+
+      /** word u of buffer row k is word r/e of row (b+u)*e + k of C, bits past the end are kept **/
+      const wi_t j = r/e;
+      const word keep = (j == C->x->width - 1) ? ~C->x->high_bitmask : 0;
+      for(int u=0; u<nb; u++) {
+        const rci_t c = (b+u)*e;
+        const int kmax = MIN(e, C->nrows - c);
+        for(int k=0; k<kmax; k++)
+          C->x->rows[c+k][j] = (C->x->rows[c+k][j] & keep) | t[k*__M4RIE_TRANSPOSE_BLOCK + u];
+      }
+    }
+  }
+  m4ri_mm_free(t);
+}
+
+mzed_t *mzed_transpose(mzed_t *C, const mzed_t *A) {
+  if (C == NULL)
+    C = mzed_init(A->finite_field, A->ncols, A->nrows);
+  else if (C->finite_field != A->finite_field || C->nrows != A->ncols || C->ncols != A->nrows)
+    m4ri_die("mzed_transpose: rows and columns of returned matrix must match.\n");
+  if (C == A)
+    m4ri_die("mzed_transpose: C and A must be different matrices.\n");
+
+  if (A->x->offset == 0 && C->x->offset == 0) {
+    _mzed_transpose(C, A);
+  } else {
+    for(rci_t i=0; i<A->nrows; i++)
+      for(rci_t j=0; j<A->ncols; j++)
+        mzed_write_elem(C, j, i, mzed_read_elem(A, i, j));
+  }
+  return C;
+}
+
 rci_t mzed_echelonize_naive(mzed_t *A, int full) {
   rci_t start_row,r,c,i,elim_start;
   word x = 0;
@@ -254,21 +477,7 @@ void mzed_set_ui(mzed_t *A, word value) {
 }
 
 void mzed_print(const mzed_t *A) {
-  char formatstr[10];
-  int width = (A->w/4);
-  if (A->w%4) 
-    width += 1;
-  sprintf(formatstr,"%%%dx",width);
-  for (rci_t i=0; i < A->nrows; ++i) {
-    printf("[");
-    for (rci_t j=0; j < A->ncols; j++) {
-      word tmp = mzed_read_elem(A,i,j);
-      printf(formatstr,(int)tmp);
-      if(j<A->ncols-1)
-        printf(" ");
-    }
-    printf("]\n");
-  }
+  mzed_fprint(stdout, A, M4RIE_FORMAT_PLAIN);
 }
 
 void mzed_add_multiple_of_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br, word x, rci_t start_col) {
@@ -276,8 +485,6 @@ void mzed_add_multiple_of_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br, wo
   assert(A->x->offset == B->x->offset);
   assert(start_col < A->ncols);
 
-  const gf2e *ff = A->finite_field;
-
   if (x == 0) {
     return;
   } else if(x == 1) {
@@ -287,347 +494,41 @@ void mzed_add_multiple_of_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br, wo
 
   const rci_t start = A->x->offset + A->w*start_col;
   const wi_t startblock = start/m4ri_radix;
+  const word bitmask_begin = __M4RI_RIGHT_BITMASK(m4ri_radix - (start%m4ri_radix));
   const word bitmask_end = __M4RI_LEFT_BITMASK((A->x->offset + A->x->ncols) % m4ri_radix);
 
-  mzd_t *from_x = B->x;
-  mzd_t *to_x = A->x;
-  word *_f = from_x->rows[br];
-  word *_t = to_x->rows[ar];
-  wi_t j;
-
-  register word __f = _f[startblock]>>(start%m4ri_radix);
-  register word __t = _t[startblock];
-
-  if(A->w == 2) {
-    switch( (start/2) % 32) {
-    case  0:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 0;  __f >>= 2;
-    case  1:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 2;  __f >>= 2;
-    case  2:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 4;  __f >>= 2;
-    case  3:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 6;  __f >>= 2;
-    case  4:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 8;  __f >>= 2;
-    case  5:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<10;  __f >>= 2;
-    case  6:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<12;  __f >>= 2;
-    case  7:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<14;  __f >>= 2;
-    case  8:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<16;  __f >>= 2;
-    case  9:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<18;  __f >>= 2;
-    case 10:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<20;  __f >>= 2;
-    case 11:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<22;  __f >>= 2;
-    case 12:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<24;  __f >>= 2;
-    case 13:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<26;  __f >>= 2;
-    case 14:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<28;  __f >>= 2;
-    case 15:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<30;  __f >>= 2;
-    case 16:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<32;  __f >>= 2;
-    case 17:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<34;  __f >>= 2;
-    case 18:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<36;  __f >>= 2;
-    case 19:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<38;  __f >>= 2;
-    case 20:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<40;  __f >>= 2;
-    case 21:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<42;  __f >>= 2;
-    case 22:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<44;  __f >>= 2;
-    case 23:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<46;  __f >>= 2;
-    case 24:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<48;  __f >>= 2;
-    case 25:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<50;  __f >>= 2;
-    case 26:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<52;  __f >>= 2;
-    case 27:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<54;  __f >>= 2;
-    case 28:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<56;  __f >>= 2;
-    case 29:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<58;  __f >>= 2;
-    case 30:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<60;  __f >>= 2;
-    case 31:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<62;  break;
-    default: m4ri_die("impossible");
-    }
-
-    if(to_x->width-startblock == 1) {
-      _t[startblock] &= ~bitmask_end;
-      _t[startblock] ^= __t & bitmask_end;
-      return;
-    } else {
-      _t[startblock] = __t;
-    }
-
-    for(j=startblock+1; j<to_x->width -1; j++) {
-      __f = _f[j], __t = _t[j];
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 0;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 2;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 4;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 6;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 8;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<10;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<12;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<14;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<16;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<18;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<20;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<22;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<24;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<26;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<28;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<30;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<32;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<34;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<36;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<38;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<40;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<42;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<44;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<46;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<48;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<50;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<52;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<54;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<56;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<58;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<60;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<62;
-      _t[j] = __t;
-    }
-
-    switch((to_x->offset + to_x->ncols) % m4ri_radix) {
-    case  0: _t[j] ^= ff->mul(ff, x, (_f[j] & 0xC000000000000000ULL)>>62)<<62;
-    case 62: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x3000000000000000ULL)>>60)<<60;
-    case 60: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0C00000000000000ULL)>>58)<<58;
-    case 58: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0300000000000000ULL)>>56)<<56;
-    case 56: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00C0000000000000ULL)>>54)<<54;
-    case 54: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0030000000000000ULL)>>52)<<52;
-    case 52: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000C000000000000ULL)>>50)<<50;
-    case 50: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0003000000000000ULL)>>48)<<48;
-    case 48: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000C00000000000ULL)>>46)<<46;
-    case 46: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000300000000000ULL)>>44)<<44;
-    case 44: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000C0000000000ULL)>>42)<<42;
-    case 42: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000030000000000ULL)>>40)<<40;
-    case 40: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000C000000000ULL)>>38)<<38;
-    case 38: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000003000000000ULL)>>36)<<36;
-    case 36: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000C00000000ULL)>>34)<<34;
-    case 34: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000300000000ULL)>>32)<<32;
-    case 32: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000C0000000ULL)>>30)<<30;
-    case 30: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000030000000ULL)>>28)<<28;
-    case 28: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000C000000ULL)>>26)<<26;
-    case 26: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000003000000ULL)>>24)<<24;
-    case 24: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000C00000ULL)>>22)<<22;
-    case 22: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000300000ULL)>>20)<<20;
-    case 20: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000000C0000ULL)>>18)<<18;
-    case 18: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000030000ULL)>>16)<<16;
-    case 16: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000000C000ULL)>>14)<<14;
-    case 14: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000003000ULL)>>12)<<12;
-    case 12: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000000C00ULL)>>10)<<10;
-    case 10: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000000300ULL)>> 8)<< 8;
-    case  8: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000000000C0ULL)>> 6)<< 6;
-    case  6: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000000030ULL)>> 4)<< 4;
-    case  4: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000000000CULL)>> 2)<< 2;
-    case  2: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000000003ULL)>> 0)<< 0;
-    };
-
-  } else if(A->w == 4) {
-    switch( (start/4) % 16 ) {
-    case  0: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<< 0;  __f >>= 4;
-    case  1: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<< 4;  __f >>= 4;
-    case  2: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<< 8;  __f >>= 4;
-    case  3: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<12;  __f >>= 4;
-    case  4: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<16;  __f >>= 4;
-    case  5: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<20;  __f >>= 4;
-    case  6: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<24;  __f >>= 4;
-    case  7: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<28;  __f >>= 4;
-    case  8: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<32;  __f >>= 4;
-    case  9: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<36;  __f >>= 4;
-    case 10: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<40;  __f >>= 4;
-    case 11: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<44;  __f >>= 4;
-    case 12: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<48;  __f >>= 4;
-    case 13: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<52;  __f >>= 4;
-    case 14: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<56;  __f >>= 4;
-    case 15: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<60;  break;
-    default: m4ri_die("impossible");
-    }
-
-    if(to_x->width-startblock == 1) {
-      _t[startblock] &= ~bitmask_end;
-      _t[startblock] ^= __t & bitmask_end;
-      return;
-    } else {
-      _t[startblock] = __t;
-    }
-
-    for(j=startblock+1; j<to_x->width -1; j++) {
-      __f = _f[j], __t = _t[j];
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<< 0;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<< 4;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<< 8;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<12;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<16;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<20;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<24;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<28;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<32;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<36;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<40;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<44;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<48;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<52;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<56;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<60;
-      _t[j] = __t;
-    }
-
-    switch((to_x->offset + to_x->ncols) % m4ri_radix) {
-    case  0: _t[j] ^= ff->mul(ff, x, (_f[j] & 0xF000000000000000ULL)>>60)<<60;
-    case 60: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0F00000000000000ULL)>>56)<<56;
-    case 56: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00F0000000000000ULL)>>52)<<52;
-    case 52: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000F000000000000ULL)>>48)<<48;
-    case 48: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000F00000000000ULL)>>44)<<44;
-    case 44: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000F0000000000ULL)>>40)<<40;
-    case 40: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000F000000000ULL)>>36)<<36;
-    case 36: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000F00000000ULL)>>32)<<32;
-    case 32: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000F0000000ULL)>>28)<<28;
-    case 28: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000F000000ULL)>>24)<<24;
-    case 24: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000F00000ULL)>>20)<<20;
-    case 20: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000000F0000ULL)>>16)<<16;
-    case 16: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000000F000ULL)>>12)<<12;
-    case 12: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000000F00ULL)>> 8)<< 8;
-    case  8: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000000000F0ULL)>> 4)<< 4;
-    case  4: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000000000FULL)>> 0)<< 0;
-    };
-
-  } else if (A->w == 8) {
-    register word __t0 ,__t1, __f0, __f1;
-
-    __f0 = _f[startblock]>>(start%m4ri_radix), __t0 = _t[startblock];
-    switch( (start/8) % 8 ) {
-    case 0: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<< 0; __f0 >>= 8;
-    case 1: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<< 8; __f0 >>= 8;
-    case 2: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<16; __f0 >>= 8;
-    case 3: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<24; __f0 >>= 8;
-    case 4: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<32; __f0 >>= 8;
-    case 5: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<40; __f0 >>= 8;
-    case 6: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<48; __f0 >>= 8;
-    case 7: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<56; break;
-    default: m4ri_die("impossible");
-    }
-
-    if(to_x->width-startblock == 1) {
-      _t[startblock] &= ~bitmask_end;
-      _t[startblock] ^= __t0 & bitmask_end;
-      return;
-    } else {
-      _t[startblock] = __t0;
-    }
-
-    for(j=startblock+1; j+2 < to_x->width; j+=2) {
-      __f0 = _f[j], __t0 = _t[j];
-      __f1 = _f[j+1], __t1 = _t[j+1];
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<< 0; __f0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<< 0; __f1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<< 8; __f0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<< 8; __f1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<16; __f0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<<16; __f1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<24; __f0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<<24; __f1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<32; __f0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<<32; __f1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<40; __f0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<<40; __f1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<48; __f0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<<48; __f1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<56;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<<56;
-      _t[j+0] = __t0;
-      _t[j+1] = __t1;
-    }
-
-    for(; j < to_x->width-1; j++) {
-      __f0 = _f[j], __t0 = _t[j];
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<< 0; __f0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<< 8; __f0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<16; __f0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<24; __f0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<32; __f0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<40; __f0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<48; __f0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<56;
-      _t[j] = __t0;
-    }
+  A->kernels->add_multiple_of_row(A->x->rows[ar] + startblock, B->x->rows[br] + startblock, A->x->width - startblock,
+                                  A->finite_field, x, bitmask_begin, bitmask_end);
+}
 
-    switch((to_x->offset + to_x->ncols) % m4ri_radix) {
-    case  0: _t[j] ^= ff->mul(ff, x, (_f[j] & 0xFF00000000000000ULL)>>56)<<56;
-    case 56: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00FF000000000000ULL)>>48)<<48;
-    case 48: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000FF0000000000ULL)>>40)<<40;
-    case 40: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000FF00000000ULL)>>32)<<32;
-    case 32: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000FF000000ULL)>>24)<<24;
-    case 24: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000FF0000ULL)>>16)<<16;
-    case 16: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000000FF00ULL)>> 8)<< 8;
-    case  8: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000000000FFULL)>> 0)<< 0;
-    };
-
-  } else if (A->w == 16) {
-    mzd_t *from_x = B->x;
-    mzd_t *to_x = A->x;
-    word *_f = from_x->rows[br];
-    word *_t = to_x->rows[ar];
-    size_t j;
-    register word __t, __f;
-
-    __f = _f[startblock]>>(start%m4ri_radix), __t = _t[startblock];
-    switch( (start/16)%4 ) {
-    case 0: __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
-    case 1: __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
-    case 2: __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
-    case 3: __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<48; break;
-    default: m4ri_die("impossible");
-    }
-    if(to_x->width-startblock == 1) {
-      _t[startblock] &= ~bitmask_end;
-      _t[startblock] ^= __t & bitmask_end;
-      return;
-    } else {
-      _t[startblock] = __t;
-    }
+void mzed_add_multiple_of_rows(mzed_t *A, rci_t ar, const mzed_t *B, const rci_t *rows, const word *scalars, int k, rci_t start_col) {
+  assert(A->ncols == B->ncols && A->finite_field == B->finite_field);
+  assert(A->x->offset == B->x->offset);
 
-    for(j=startblock+1; j+4<to_x->width; j+=4) {
-      __f = _f[j], __t = _t[j];
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
-      _t[j] = __t;
-
-      __f = _f[j+1], __t = _t[j+1];
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
-      _t[j+1] = __t;
-
-
-      __f = _f[j+2], __t = _t[j+2];
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
-      _t[j+2] = __t;
-
-      __f = _f[j+3], __t = _t[j+3];
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
-      _t[j+3] = __t;
-    }
-    for( ; j<to_x->width-1; j++) {
-      __f = _f[j], __t = _t[j];
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
-      _t[j] = __t;
-    }
+  if (start_col >= A->ncols)
+    return;
 
-    switch((to_x->offset + to_x->ncols) % m4ri_radix) {
-    case  0: _t[j] ^= ff->mul(ff, x, (_f[j] & 0xFFFF000000000000ULL)>>48)<<48;
-    case 48: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000FFFF00000000ULL)>>32)<<32;
-    case 32: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000FFFF0000ULL)>>16)<<16;
-    case 16: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000000FFFFULL)>> 0)<< 0;
-    };
+  const rci_t start = A->x->offset + A->w*start_col;
+  const wi_t startblock = start/m4ri_radix;
+  const word bitmask_begin = __M4RI_RIGHT_BITMASK(m4ri_radix - (start%m4ri_radix));
+  const word bitmask_end = __M4RI_LEFT_BITMASK((A->x->offset + A->x->ncols) % m4ri_radix);
 
-  }  else {
-    for(rci_t j=start_col; j<B->ncols; j++) {
-      mzed_add_elem(A, ar, j, ff->mul(ff, x, mzed_read_elem(B, br, j)));
+  word *t = A->x->rows[ar] + startblock;
+  const word *f[__M4RIE_SIMD_MAX_ROWS];
+  word x[__M4RIE_SIMD_MAX_ROWS];
+  int l = 0;
+
+  for(int i=0; i<k; i++) {
+    if (scalars[i] == 0)
+      continue;
+    assert((A != B) || rows[i] != ar);
+    f[l] = B->x->rows[rows[i]] + startblock;
+    x[l] = scalars[i];
+    if (++l == __M4RIE_SIMD_MAX_ROWS) {
+      A->kernels->add_multiple_of_rows(t, f, x, l, A->x->width - startblock, A->finite_field, bitmask_begin, bitmask_end);
+      l = 0;
     }
   }
+  if (l)
+    A->kernels->add_multiple_of_rows(t, f, x, l, A->x->width - startblock, A->finite_field, bitmask_begin, bitmask_end);
 }
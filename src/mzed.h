@@ -48,7 +48,39 @@
 
 #include <m4ri/m4ri.h>
 #include <m4rie/gf2e.h>
+#include <m4rie/gf2e_simd.h>
 #include <m4rie/m4ri_functions.h>
+#include <m4rie/random.h>
+
+/**
+ * \brief Row operations specialised for one element width and multiplication routine.
+ *
+ * All operate on the n words starting at t (and f), the first word is masked with mask_begin
+ * and the last word with mask_end. See mzed_kernels.inl.
+ *
+ * \ingroup Definitions
+ */
+
+typedef struct {
+  /** t += x*f */
+  void (*add_multiple_of_row)(word *t, const word *f, const wi_t n, const gf2e *ff, const word x,
+                              const word mask_begin, const word mask_end);
+  /** t = x*t */
+  void (*rescale_row)(word *t, const wi_t n, const gf2e *ff, const word x,
+                      const word mask_begin, const word mask_end);
+  /** t += x[0]*f[0] + ... + x[k-1]*f[k-1] for k <= __M4RIE_SIMD_MAX_ROWS, t is streamed once */
+  void (*add_multiple_of_rows)(word *t, const word *const *f, const word *x, const int k, const wi_t n,
+                               const gf2e *ff, const word mask_begin, const word mask_end);
+} mzed_kernels_t;
+
+/**
+ * \brief Return the row kernels for elements of ff packed in width w.
+ *
+ * \param ff Finite field.
+ * \param w Width of packed elements.
+ */
+
+const mzed_kernels_t *mzed_kernels(const gf2e *ff, const wi_t w);
 
 /**
  * \brief Dense matrices over \GF2E represented as packed matrices.
@@ -62,6 +94,7 @@ typedef struct {
   rci_t nrows; /**< Number of rows. */
   rci_t ncols; /**< Number of columns. */
   wi_t w;   /**< The internal width of elements (must divide 64). */
+  const mzed_kernels_t *kernels; /**< Row operations for finite_field and w, chosen once. */
 } mzed_t;
 
 
@@ -188,6 +221,7 @@ static inline mzed_t *mzed_init_window(const mzed_t *A, const rci_t lowr, const
   mzed_t *B = (mzed_t *)m4ri_mm_malloc(sizeof(mzed_t));
   B->finite_field = A->finite_field;
   B->w = gf2e_degree_to_w(A->finite_field);
+  B->kernels = A->kernels;
   B->nrows = highr - lowr;
   B->ncols = highc - lowc;
   B->x = mzd_init_window(A->x, lowr, B->w*lowc, highr, B->w*highc);
@@ -282,6 +316,23 @@ mzed_t *mzed_mul(mzed_t *C, const mzed_t *A, const mzed_t *B);
 
 mzed_t *mzed_addmul(mzed_t *C, const mzed_t *A, const mzed_t *B);
 
+/**
+ * \brief Return whether _mzed_mul() and _mzed_addmul() use Karatsuba multiplication for an m x l
+ * times l x n product over ff.
+ *
+ * \param ff Finite field.
+ * \param m Number of rows of A.
+ * \param l Number of columns of A.
+ * \param n Number of columns of B.
+ */
+
+static inline int _mzed_mul_use_karatsuba(const gf2e *ff, const rci_t m, const rci_t l, const rci_t n) {
+  if (m >= 512 && l >= 512 && n >= 512)
+    return 1;
+  /** there are no Newton-John tables for large fields **/
+  return (ff->degree > M4RIE_MAX_TABLE_DEGREE && m >= 64 && l >= 64 && n >= 64);
+}
+
 /**
  * \brief \f$ C = A \cdot B \f$.
  *
@@ -361,6 +412,12 @@ mzed_t *_mzed_mul_naive(mzed_t *C, const mzed_t *A, const mzed_t *B);
 
 mzed_t *mzed_mul_scalar(mzed_t *C, const word a, const mzed_t *B);
 
+/**
+ * Matrices with fewer elements are multiplied by a scalar without gf2e_mul_table_get().
+ */
+
+#define __M4RIE_MUL_TABLE_CUTOFF (1<<12)
+
 /**
  * Check whether C, A and B match in sizes and fields for
  * multiplication
@@ -376,15 +433,61 @@ mzed_t *_mzed_mul_init(mzed_t *C, const mzed_t *A, const mzed_t *B, int clear);
 /**
  * \brief Fill matrix A with random elements.
  *
- * \param A Matrix
+ * Uses random(), see mzed_randomize_rng() for other generators.
  *
- * \todo Allow the user to provide a RNG callback.
+ * \param A Matrix
  *
  * \ingroup Assignment
  */
 
 void mzed_randomize(mzed_t *A);
 
+/**
+ * \brief Fill matrix A with random elements from rng.
+ *
+ * One word of 64 random bits is drawn per word of A and masked to the field, i.e. the elements
+ * are uniformly distributed if rng is.
+ *
+ * \param A Matrix
+ * \param rng Random number generator, e.g. m4rie_prng_next(). If NULL m4rie_random_libc() is used.
+ * \param state State passed to rng.
+ *
+ * \ingroup Assignment
+ */
+
+void mzed_randomize_rng(mzed_t *A, m4rie_random_t rng, void *state);
+
+/**
+ * \brief Fill matrix A with a random matrix of rank r.
+ *
+ * A is computed as P*L*U where L is unit lower trapezoidal, U is in row echelon form with random
+ * non-zero pivots in r random columns and P is a random row permutation. No rejection sampling
+ * is involved.
+ *
+ * \param A Matrix with offset zero.
+ * \param r Rank, at most min(A->nrows, A->ncols).
+ * \param rng Random number generator, if NULL m4rie_random_libc() is used.
+ * \param state State passed to rng.
+ *
+ * \ingroup Assignment
+ */
+
+void mzed_randomize_rank(mzed_t *A, const rci_t r, m4rie_random_t rng, void *state);
+
+/**
+ * \brief Fill the square matrix A with a random invertible matrix.
+ *
+ * \param A Square matrix with offset zero.
+ * \param rng Random number generator, if NULL m4rie_random_libc() is used.
+ * \param state State passed to rng.
+ *
+ * \sa mzed_randomize_rank()
+ *
+ * \ingroup Assignment
+ */
+
+void mzed_randomize_invertible(mzed_t *A, m4rie_random_t rng, void *state);
+
 /**
  * \brief Copy matrix A to B.
  *
@@ -396,6 +499,17 @@ void mzed_randomize(mzed_t *A);
 
 mzed_t *mzed_copy(mzed_t *B, const mzed_t *A);
 
+/**
+ * \brief Return the transpose of A.
+ *
+ * \param C Preallocated matrix with A->ncols rows and A->nrows columns, different from A, or NULL.
+ * \param A Matrix.
+ *
+ * \ingroup Assignment
+ */
+
+mzed_t *mzed_transpose(mzed_t *C, const mzed_t *A);
+
 /**
  * \brief Return diagonal matrix with value on the diagonal.
  *
@@ -500,6 +614,26 @@ static inline int mzed_is_zero(const mzed_t *A) {
 
 void mzed_add_multiple_of_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br, word x, rci_t start_col);
 
+/**
+ * A[ar,c] = A[ar,c] + sum_i scalars[i]*B[rows[i],c] for all c >= startcol.
+ *
+ * This is equivalent to k calls to mzed_add_multiple_of_row() but the row ar is only read and
+ * written once per __M4RIE_SIMD_MAX_ROWS rows of B.
+ * Nothing is done if start_col >= A->ncols, in particular for matrices without columns.
+ *
+ * \param A Matrix.
+ * \param ar Row index in A.
+ * \param B Matrix.
+ * \param rows k row indices in B, if A == B none of them may be ar.
+ * \param scalars k finite field elements.
+ * \param k Number of rows.
+ * \param start_col Column index.
+ *
+ * \ingroup RowOperations
+ */
+
+void mzed_add_multiple_of_rows(mzed_t *A, rci_t ar, const mzed_t *B, const rci_t *rows, const word *scalars, int k, rci_t start_col);
+
 /**
  * A[ar,c] = A[ar,c] + B[br,c] for all c >= startcol.
  *
@@ -550,351 +684,12 @@ static inline void mzed_add_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br,
 static inline void mzed_rescale_row(mzed_t *A, rci_t r, rci_t start_col, const word x) {
   assert(start_col < A->ncols);
 
-  const gf2e *ff = A->finite_field;
   const rci_t start = A->x->offset + A->w*start_col;
   const wi_t startblock = start/m4ri_radix;
-  word *_a = A->x->rows[r];
   const word bitmask_begin = __M4RI_RIGHT_BITMASK(m4ri_radix - (start%m4ri_radix));
   const word bitmask_end = __M4RI_LEFT_BITMASK((A->x->offset + A->x->ncols) % m4ri_radix);
-  register word __a = _a[startblock]>>(start%m4ri_radix);
-  register word __t = 0;
-  int j;
-
-  if(A->w == 2) {
-    switch( (start/2) % 32 ) {
-    case  0:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 0;  __a >>= 2;
-    case  1:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 2;  __a >>= 2;
-    case  2:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 4;  __a >>= 2;
-    case  3:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 6;  __a >>= 2;
-    case  4:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 8;  __a >>= 2;
-    case  5:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<10;  __a >>= 2;
-    case  6:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<12;  __a >>= 2;
-    case  7:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<14;  __a >>= 2;
-    case  8:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<16;  __a >>= 2;
-    case  9:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<18;  __a >>= 2;
-    case 10:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<20;  __a >>= 2;
-    case 11:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<22;  __a >>= 2;
-    case 12:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<24;  __a >>= 2;
-    case 13:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<26;  __a >>= 2;
-    case 14:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<28;  __a >>= 2;
-    case 15:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<30;  __a >>= 2;
-    case 16:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<32;  __a >>= 2;
-    case 17:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<34;  __a >>= 2;
-    case 18:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<36;  __a >>= 2;
-    case 19:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<38;  __a >>= 2;
-    case 20:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<40;  __a >>= 2;
-    case 21:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<42;  __a >>= 2;
-    case 22:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<44;  __a >>= 2;
-    case 23:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<46;  __a >>= 2;
-    case 24:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<48;  __a >>= 2;
-    case 25:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<50;  __a >>= 2;
-    case 26:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<52;  __a >>= 2;
-    case 27:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<54;  __a >>= 2;
-    case 28:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<56;  __a >>= 2;
-    case 29:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<58;  __a >>= 2;
-    case 30:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<60;  __a >>= 2;
-    case 31:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<62;  break;
-    default: m4ri_die("impossible");
-    }
-    if(A->x->width-startblock == 1) {
-      _a[startblock] &= ~(bitmask_begin & bitmask_end);
-      _a[startblock] ^= __t & bitmask_begin & bitmask_end;
-      return;
-    } else {
-      _a[startblock] &= ~bitmask_begin;
-      _a[startblock] ^= __t & bitmask_begin;
-    }
-
-    for(j=startblock+1; j<A->x->width -1; j++) {
-      __a = _a[j], __t = 0;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 0;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 2;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 4;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 6;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 8;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<10;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<12;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<14;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<16;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<18;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<20;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<22;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<24;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<26;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<28;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<30;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<32;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<34;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<36;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<38;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<40;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<42;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<44;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<46;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<48;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<50;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<52;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<54;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<56;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<58;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<60;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<62;
-      _a[j] = __t;
-    }
-
-    __t = _a[j] & ~bitmask_end;
-    switch((A->x->offset+A->x->ncols) % m4ri_radix) {
-    case  0: __t ^= ff->mul(ff, x, (_a[j] & 0xC000000000000000ULL)>>62)<<62;
-    case 62: __t ^= ff->mul(ff, x, (_a[j] & 0x3000000000000000ULL)>>60)<<60;
-    case 60: __t ^= ff->mul(ff, x, (_a[j] & 0x0C00000000000000ULL)>>58)<<58;
-    case 58: __t ^= ff->mul(ff, x, (_a[j] & 0x0300000000000000ULL)>>56)<<56;
-    case 56: __t ^= ff->mul(ff, x, (_a[j] & 0x00C0000000000000ULL)>>54)<<54;
-    case 54: __t ^= ff->mul(ff, x, (_a[j] & 0x0030000000000000ULL)>>52)<<52;
-    case 52: __t ^= ff->mul(ff, x, (_a[j] & 0x000C000000000000ULL)>>50)<<50;
-    case 50: __t ^= ff->mul(ff, x, (_a[j] & 0x0003000000000000ULL)>>48)<<48;
-    case 48: __t ^= ff->mul(ff, x, (_a[j] & 0x0000C00000000000ULL)>>46)<<46;
-    case 46: __t ^= ff->mul(ff, x, (_a[j] & 0x0000300000000000ULL)>>44)<<44;
-    case 44: __t ^= ff->mul(ff, x, (_a[j] & 0x00000C0000000000ULL)>>42)<<42;
-    case 42: __t ^= ff->mul(ff, x, (_a[j] & 0x0000030000000000ULL)>>40)<<40;
-    case 40: __t ^= ff->mul(ff, x, (_a[j] & 0x000000C000000000ULL)>>38)<<38;
-    case 38: __t ^= ff->mul(ff, x, (_a[j] & 0x0000003000000000ULL)>>36)<<36;
-    case 36: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000C00000000ULL)>>34)<<34;
-    case 34: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000300000000ULL)>>32)<<32;
-    case 32: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000C0000000ULL)>>30)<<30;
-    case 30: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000030000000ULL)>>28)<<28;
-    case 28: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000C000000ULL)>>26)<<26;
-    case 26: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000003000000ULL)>>24)<<24;
-    case 24: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000C00000ULL)>>22)<<22;
-    case 22: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000300000ULL)>>20)<<20;
-    case 20: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000000C0000ULL)>>18)<<18;
-    case 18: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000030000ULL)>>16)<<16;
-    case 16: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000000C000ULL)>>14)<<14;
-    case 14: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000003000ULL)>>12)<<12;
-    case 12: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000000C00ULL)>>10)<<10;
-    case 10: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000000300ULL)>> 8)<< 8;
-    case  8: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000000000C0ULL)>> 6)<< 6;
-    case  6: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000000030ULL)>> 4)<< 4;
-    case  4: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000000000CULL)>> 2)<< 2;
-    case  2: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000000003ULL)>> 0)<< 0;
-    };
-    _a[j] = __t;
-
-  } else if(A->w == 4) {
-    switch( (start/4)%16 ) {
-    case  0: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<< 0;  __a >>= 4;
-    case  1: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<< 4;  __a >>= 4;
-    case  2: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<< 8;  __a >>= 4;
-    case  3: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<12;  __a >>= 4;
-    case  4: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<16;  __a >>= 4;
-    case  5: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<20;  __a >>= 4;
-    case  6: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<24;  __a >>= 4;
-    case  7: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<28;  __a >>= 4;
-    case  8: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<32;  __a >>= 4;
-    case  9: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<36;  __a >>= 4;
-    case 10: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<40;  __a >>= 4;
-    case 11: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<44;  __a >>= 4;
-    case 12: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<48;  __a >>= 4;
-    case 13: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<52;  __a >>= 4;
-    case 14: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<56;  __a >>= 4;
-    case 15: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<60;  break;
-    default: m4ri_die("impossible");
-    }
-    if(A->x->width-startblock == 1) {
-      _a[startblock] &= ~(bitmask_begin & bitmask_end);
-      _a[startblock] ^= __t & bitmask_begin & bitmask_end;
-      return;
-    } else {
-      _a[startblock] &= ~bitmask_begin;
-      _a[startblock] ^= __t & bitmask_begin;
-    }
-
-    for(j=startblock+1; j<A->x->width -1; j++) {
-      __a = _a[j], __t = 0;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<< 0;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<< 4;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<< 8;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<12;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<16;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<20;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<24;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<28;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<32;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<36;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<40;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<44;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<48;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<52;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<56;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<60;
-      _a[j] = __t;
-    }
-
-    __t = _a[j] & ~bitmask_end;
-    switch( (A->x->offset + A->x->ncols) % m4ri_radix) {
-    case  0: __t ^= ff->mul(ff, x, (_a[j] & 0xF000000000000000ULL)>>60)<<60;
-    case 60: __t ^= ff->mul(ff, x, (_a[j] & 0x0F00000000000000ULL)>>56)<<56;
-    case 56: __t ^= ff->mul(ff, x, (_a[j] & 0x00F0000000000000ULL)>>52)<<52;
-    case 52: __t ^= ff->mul(ff, x, (_a[j] & 0x000F000000000000ULL)>>48)<<48;
-    case 48: __t ^= ff->mul(ff, x, (_a[j] & 0x0000F00000000000ULL)>>44)<<44;
-    case 44: __t ^= ff->mul(ff, x, (_a[j] & 0x00000F0000000000ULL)>>40)<<40;
-    case 40: __t ^= ff->mul(ff, x, (_a[j] & 0x000000F000000000ULL)>>36)<<36;
-    case 36: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000F00000000ULL)>>32)<<32;
-    case 32: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000F0000000ULL)>>28)<<28;
-    case 28: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000F000000ULL)>>24)<<24;
-    case 24: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000F00000ULL)>>20)<<20;
-    case 20: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000000F0000ULL)>>16)<<16;
-    case 16: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000000F000ULL)>>12)<<12;
-    case 12: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000000F00ULL)>> 8)<< 8;
-    case  8: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000000000F0ULL)>> 4)<< 4;
-    case  4: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000000000FULL)>> 0)<< 0;
-    };
-    _a[j] = __t;
-
-  } else if (A->w == 8) {
-
-    register word __a0 = _a[startblock]>>(start%m4ri_radix);
-    register word __a1;
-    register word __t0 = 0;
-    register word __t1;
-
-    switch( (start/8) %8 ) {
-    case 0: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<< 0; __a0 >>= 8;
-    case 1: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<< 8; __a0 >>= 8;
-    case 2: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<<16; __a0 >>= 8;
-    case 3: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<<24; __a0 >>= 8;
-    case 4: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<<32; __a0 >>= 8;
-    case 5: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<<40; __a0 >>= 8;
-    case 6: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<<48; __a0 >>= 8;
-    case 7: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<<56; break;
-    default: m4ri_die("impossible");
-    }
-    if(A->x->width-startblock == 1) {
-      _a[startblock] &= ~(bitmask_begin & bitmask_end);
-      _a[startblock] ^= __t0 & bitmask_begin & bitmask_end;
-      return;
-    } else {
-      _a[startblock] &= ~bitmask_begin;
-      _a[startblock] ^= __t0 & bitmask_begin;
-    }
-
-    for(j=startblock+1; j+2 < A->x->width; j+=2) {
-      __a0 = _a[j], __t0 = 0;
-      __a1 = _a[j+1], __t1 = 0;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<< 0; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<< 0; __a1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<< 8; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<< 8; __a1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<16; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<<16; __a1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<24; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<<24; __a1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<32; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<<32; __a1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<40; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<<40; __a1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<48; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<<48; __a1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<56; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<<56;
-      _a[j+0] = __t0;
-      _a[j+1] = __t1;
-    }
-
-    for(; j < A->x->width-1; j++) {
-      __a0 = _a[j], __t0 = 0;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<< 0; __a0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<< 8; __a0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<16; __a0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<24; __a0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<32; __a0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<40; __a0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<48; __a0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<56;
-      _a[j] = __t0;
-    }
-
-    __t = _a[j] & ~bitmask_end;
-    switch( (A->x->offset + A->x->ncols) % m4ri_radix ) {
-    case  0: __t ^= ff->mul(ff, x, (_a[j] & 0xFF00000000000000ULL)>>56)<<56;
-    case 56: __t ^= ff->mul(ff, x, (_a[j] & 0x00FF000000000000ULL)>>48)<<48;
-    case 48: __t ^= ff->mul(ff, x, (_a[j] & 0x0000FF0000000000ULL)>>40)<<40;
-    case 40: __t ^= ff->mul(ff, x, (_a[j] & 0x000000FF00000000ULL)>>32)<<32;
-    case 32: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000FF000000ULL)>>24)<<24;
-    case 24: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000FF0000ULL)>>16)<<16;
-    case 16: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000000FF00ULL)>> 8)<< 8;
-    case  8: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000000000FFULL)>> 0)<< 0;
-    };
-    _a[j] = __t;
-
-  } else if (A->w == 16) {
-    switch( (start/16) %4 ) {
-    case 0: __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
-    case 1: __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
-    case 2: __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
-    case 3: __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<48; break;
-    default: m4ri_die("impossible");
-    }
-    if(A->x->width-startblock == 1) {
-      _a[startblock] &= ~(bitmask_begin & bitmask_end);
-      _a[startblock] ^= __t & bitmask_begin & bitmask_end;
-      return;
-    } else {
-      _a[startblock] &= ~bitmask_begin;
-      _a[startblock] ^= __t & bitmask_begin;
-    }
-
-    for(j=startblock+1; j+4<A->x->width; j+=4) {
-      __a = _a[j], __t = 0;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
-      _a[j] = __t;
-
-      __a = _a[j+1], __t = 0;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
-      _a[j+1] = __t;
-
-      __a = _a[j+2], __t = 0;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
-      _a[j+2] = __t;
-
-      __a = _a[j+3], __t = 0;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
-      _a[j+3] = __t;
-    }
-    for( ; j<A->x->width-1; j++) {
-      __a = _a[j], __t = 0;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
-      _a[j] = __t;
-    }
-
-    __t = _a[j] & ~bitmask_end;
-    switch( (A->x->offset + A->x->ncols) % m4ri_radix) {
-    case  0: __t ^= ff->mul(ff, x, (_a[j] & 0xFFFF000000000000ULL)>>48)<<48;
-    case 48: __t ^= ff->mul(ff, x, (_a[j] & 0x0000FFFF00000000ULL)>>32)<<32;
-    case 32: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000FFFF0000ULL)>>16)<<16;
-    case 16: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000000FFFFULL)>> 0)<< 0;
-    };
-    _a[j] = __t;
 
-  } else {
-    for(rci_t j=start_col; j<A->ncols; j++) {
-      mzed_write_elem(A, r, j, ff->mul(ff, x, mzed_read_elem(A, r, j)));
-    }
-  }
+  A->kernels->rescale_row(A->x->rows[r] + startblock, A->x->width - startblock, A->finite_field, x, bitmask_begin, bitmask_end);
 }
 
 /**
@@ -0,0 +1,213 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include "config.h"
+#include "mzed.h"
+#include "gf2e_simd.h"
+
+#ifdef __M4RIE_HAVE_X86_SIMD
+#include <wmmintrin.h>
+#endif
+
+/**
+ * Multiplication tables, the row of x is fetched once.
+ */
+
+#define __M4RIE_KERNEL_ATTR
+#define __M4RIE_KERNEL_INIT(ff, x) const word *__mx = (ff)->_mul[x]
+#define __M4RIE_KERNEL_MUL(a) __mx[a]
+
+#define __M4RIE_KERNEL(name) name ## _w2_table
+#define __M4RIE_KERNEL_W 2
+#include "mzed_kernels.inl"
+#undef __M4RIE_KERNEL
+#undef __M4RIE_KERNEL_W
+
+#define __M4RIE_KERNEL(name) name ## _w4_table
+#define __M4RIE_KERNEL_W 4
+#include "mzed_kernels.inl"
+#undef __M4RIE_KERNEL
+#undef __M4RIE_KERNEL_W
+
+#define __M4RIE_KERNEL(name) name ## _w8_table
+#define __M4RIE_KERNEL_W 8
+#include "mzed_kernels.inl"
+#undef __M4RIE_KERNEL
+#undef __M4RIE_KERNEL_W
+
+#undef __M4RIE_KERNEL_ATTR
+#undef __M4RIE_KERNEL_INIT
+#undef __M4RIE_KERNEL_MUL
+
+/**
+ * Log/antilog tables, the logarithm of x is fetched once.
+ */
+
+#define __M4RIE_KERNEL_ATTR
+#define __M4RIE_KERNEL_INIT(ff, x) const word *__log = (ff)->_log; const word *__exp = (ff)->_exp; const word __lx = __log[x]
+#define __M4RIE_KERNEL_MUL(a) ((a) ? __exp[__lx + __log[a]] : 0)
+
+#define __M4RIE_KERNEL(name) name ## _w2_logexp
+#define __M4RIE_KERNEL_W 2
+#include "mzed_kernels.inl"
+#undef __M4RIE_KERNEL
+#undef __M4RIE_KERNEL_W
+
+#define __M4RIE_KERNEL(name) name ## _w4_logexp
+#define __M4RIE_KERNEL_W 4
+#include "mzed_kernels.inl"
+#undef __M4RIE_KERNEL
+#undef __M4RIE_KERNEL_W
+
+#define __M4RIE_KERNEL(name) name ## _w8_logexp
+#define __M4RIE_KERNEL_W 8
+#include "mzed_kernels.inl"
+#undef __M4RIE_KERNEL
+#undef __M4RIE_KERNEL_W
+
+#define __M4RIE_KERNEL(name) name ## _w16_logexp
+#define __M4RIE_KERNEL_W 16
+#include "mzed_kernels.inl"
+#undef __M4RIE_KERNEL
+#undef __M4RIE_KERNEL_W
+
+#undef __M4RIE_KERNEL_ATTR
+#undef __M4RIE_KERNEL_INIT
+#undef __M4RIE_KERNEL_MUL
+
+#ifdef __M4RIE_HAVE_X86_SIMD
+
+/**
+ * Carry-less multiplication, see _gf2e_mul_clmul(). x and the reduction constants are loaded
+ * into registers once.
+ */
+
+__attribute__((target("pclmul,sse2")))
+static inline word _mzed_kernel_clmul(const __m128i x, const __m128i mod, const unsigned int degree, const word a) {
+  const word res = _mm_cvtsi128_si64(_mm_clmulepi64_si128(x, _mm_cvtsi64_si128(a), 0x00));
+  __m128i q = _mm_clmulepi64_si128(_mm_cvtsi64_si128(res>>degree), mod, 0x10);
+  q = _mm_clmulepi64_si128(_mm_srli_epi64(q, degree), mod, 0x00);
+  return res ^ _mm_cvtsi128_si64(q);
+}
+
+#define __M4RIE_KERNEL_ATTR __attribute__((target("pclmul,sse2")))
+#define __M4RIE_KERNEL_INIT(ff, x) const __m128i __x = _mm_cvtsi64_si128(x); \
+  const __m128i __mod = _mm_set_epi64x((ff)->_barrett, (ff)->minpoly); const unsigned int __e = (ff)->degree
+#define __M4RIE_KERNEL_MUL(a) _mzed_kernel_clmul(__x, __mod, __e, a)
+
+#define __M4RIE_KERNEL(name) name ## _w16_clmul
+#define __M4RIE_KERNEL_W 16
+#include "mzed_kernels.inl"
+#undef __M4RIE_KERNEL
+#undef __M4RIE_KERNEL_W
+
+#define __M4RIE_KERNEL(name) name ## _w32_clmul
+#define __M4RIE_KERNEL_W 32
+#include "mzed_kernels.inl"
+#undef __M4RIE_KERNEL
+#undef __M4RIE_KERNEL_W
+
+#undef __M4RIE_KERNEL_ATTR
+#undef __M4RIE_KERNEL_INIT
+#undef __M4RIE_KERNEL_MUL
+
+#endif //__M4RIE_HAVE_X86_SIMD
+
+/**
+ * Any other multiplication routine, called through gf2e::mul.
+ */
+
+#define __M4RIE_KERNEL_ATTR
+#define __M4RIE_KERNEL_INIT(ff, x) word (*__mul)(const gf2e *, const word, const word) = (ff)->mul
+#define __M4RIE_KERNEL_MUL(a) __mul(ff, x, a)
+
+#define __M4RIE_KERNEL(name) name ## _w2_generic
+#define __M4RIE_KERNEL_W 2
+#include "mzed_kernels.inl"
+#undef __M4RIE_KERNEL
+#undef __M4RIE_KERNEL_W
+
+#define __M4RIE_KERNEL(name) name ## _w4_generic
+#define __M4RIE_KERNEL_W 4
+#include "mzed_kernels.inl"
+#undef __M4RIE_KERNEL
+#undef __M4RIE_KERNEL_W
+
+#define __M4RIE_KERNEL(name) name ## _w8_generic
+#define __M4RIE_KERNEL_W 8
+#include "mzed_kernels.inl"
+#undef __M4RIE_KERNEL
+#undef __M4RIE_KERNEL_W
+
+#define __M4RIE_KERNEL(name) name ## _w16_generic
+#define __M4RIE_KERNEL_W 16
+#include "mzed_kernels.inl"
+#undef __M4RIE_KERNEL
+#undef __M4RIE_KERNEL_W
+
+#define __M4RIE_KERNEL(name) name ## _w32_generic
+#define __M4RIE_KERNEL_W 32
+#include "mzed_kernels.inl"
+#undef __M4RIE_KERNEL
+#undef __M4RIE_KERNEL_W
+
+#undef __M4RIE_KERNEL_ATTR
+#undef __M4RIE_KERNEL_INIT
+#undef __M4RIE_KERNEL_MUL
+
+const mzed_kernels_t *mzed_kernels(const gf2e *ff, const wi_t w) {
+  switch(ff->mode) {
+  case GF2E_MODE_TABLE:
+    switch(w) {
+    case  2: return &_mzed_kernels_w2_table;
+    case  4: return &_mzed_kernels_w4_table;
+    case  8: return &_mzed_kernels_w8_table;
+    }
+    break;
+  case GF2E_MODE_LOGEXP:
+    switch(w) {
+    case  2: return &_mzed_kernels_w2_logexp;
+    case  4: return &_mzed_kernels_w4_logexp;
+    case  8: return &_mzed_kernels_w8_logexp;
+    case 16: return &_mzed_kernels_w16_logexp;
+    }
+    break;
+#ifdef __M4RIE_HAVE_X86_SIMD
+  case GF2E_MODE_CLMUL:
+    switch(w) {
+    case 16: return &_mzed_kernels_w16_clmul;
+    case 32: return &_mzed_kernels_w32_clmul;
+    }
+    break;
+#endif
+  default:
+    break;
+  }
+
+  switch(w) {
+  case  2: return &_mzed_kernels_w2_generic;
+  case  4: return &_mzed_kernels_w4_generic;
+  case  8: return &_mzed_kernels_w8_generic;
+  case 16: return &_mzed_kernels_w16_generic;
+  case 32: return &_mzed_kernels_w32_generic;
+  default:
+    m4ri_die("no kernels for elements of width %d.\n", (int)w);
+  }
+  return NULL;
+}
@@ -0,0 +1,150 @@
+/**
+ * \brief inline template for degree-specialised row kernels
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ *
+ * Before including this file define
+ *
+ * - __M4RIE_KERNEL(name): the name of the instance of name
+ * - __M4RIE_KERNEL_W: the width of packed elements
+ * - __M4RIE_KERNEL_ATTR: function attributes, possibly empty
+ * - __M4RIE_KERNEL_INIT(ff, x): declarations evaluated once per call
+ * - __M4RIE_KERNEL_MUL(a): x*a using the declarations of __M4RIE_KERNEL_INIT
+ *
+ * All elements are processed with the same x, hence e.g. the table row or the logarithm of x is
+ * only looked up once and the multiplication is inlined.
+ *
+ * \note We want to keep this library in C, hence we cannot use of C++
+ * templates.
+ */
+
+#define __M4RIE_KERNEL_MUL_WORD(r, v) do {                                \
+    const word __v = (v);                                                 \
+    r = 0;                                                                \
+    for(int __k=0; __k<m4ri_radix; __k+=__M4RIE_KERNEL_W)                 \
+      r |= __M4RIE_KERNEL_MUL((__v>>__k) & __M4RI_LEFT_BITMASK(__M4RIE_KERNEL_W)) << __k; \
+  } while(0)
+
+__M4RIE_KERNEL_ATTR
+static void __M4RIE_KERNEL(_mzed_add_multiple_of_row)(word *t, const word *f, const wi_t n, const gf2e *ff, const word x,
+                                                      const word mask_begin, const word mask_end) {
+  __M4RIE_KERNEL_INIT(ff, x);
+  word r;
+
+  if (n == 1) {
+    __M4RIE_KERNEL_MUL_WORD(r, f[0] & mask_begin & mask_end);
+    t[0] ^= r;
+    return;
+  }
+
+  __M4RIE_KERNEL_MUL_WORD(r, f[0] & mask_begin);
+  t[0] ^= r;
+
+  wi_t j = 1;
+  if (gf2e_simd_mul(ff, __M4RIE_KERNEL_W, x, t + 1, f + 1, n - 2, 1))
+    j = n - 1;
+  for( ; j<n-1; j++) {
+    __M4RIE_KERNEL_MUL_WORD(r, f[j]);
+    t[j] ^= r;
+  }
+
+  __M4RIE_KERNEL_MUL_WORD(r, f[n-1] & mask_end);
+  t[n-1] ^= r;
+}
+
+__M4RIE_KERNEL_ATTR
+static void __M4RIE_KERNEL(_mzed_rescale_row)(word *t, const wi_t n, const gf2e *ff, const word x,
+                                              const word mask_begin, const word mask_end) {
+  if (x == 0) {
+    if (n == 1) {
+      t[0] &= ~(mask_begin & mask_end);
+      return;
+    }
+    t[0] &= ~mask_begin;
+    for(wi_t j=1; j<n-1; j++)
+      t[j] = 0;
+    t[n-1] &= ~mask_end;
+    return;
+  }
+
+  __M4RIE_KERNEL_INIT(ff, x);
+  word r;
+
+  if (n == 1) {
+    const word mask = mask_begin & mask_end;
+    __M4RIE_KERNEL_MUL_WORD(r, t[0] & mask);
+    t[0] = (t[0] & ~mask) | r;
+    return;
+  }
+
+  __M4RIE_KERNEL_MUL_WORD(r, t[0] & mask_begin);
+  t[0] = (t[0] & ~mask_begin) | r;
+
+  wi_t j = 1;
+  if (gf2e_simd_mul(ff, __M4RIE_KERNEL_W, x, t + 1, t + 1, n - 2, 0))
+    j = n - 1;
+  for( ; j<n-1; j++) {
+    __M4RIE_KERNEL_MUL_WORD(r, t[j]);
+    t[j] = r;
+  }
+
+  __M4RIE_KERNEL_MUL_WORD(r, t[n-1] & mask_end);
+  t[n-1] = (t[n-1] & ~mask_end) | r;
+}
+
+/**
+ * Without vector instructions each row is added to blocks of __M4RIE_KERNEL_BLOCK words of t,
+ * which stay in L1 meanwhile.
+ */
+
+#define __M4RIE_KERNEL_BLOCK 256
+
+__M4RIE_KERNEL_ATTR
+static void __M4RIE_KERNEL(_mzed_add_multiple_of_rows)(word *t, const word *const *f, const word *xs, const int k, const wi_t n,
+                                                       const gf2e *ff, const word mask_begin, const word mask_end) {
+  word r;
+
+  if (n == 1) {
+    for(int i=0; i<k; i++) {
+      const word x = xs[i];
+      __M4RIE_KERNEL_INIT(ff, x);
+      __M4RIE_KERNEL_MUL_WORD(r, f[i][0] & mask_begin & mask_end);
+      t[0] ^= r;
+    }
+    return;
+  }
+
+  for(int i=0; i<k; i++) {
+    const word x = xs[i];
+    __M4RIE_KERNEL_INIT(ff, x);
+    __M4RIE_KERNEL_MUL_WORD(r, f[i][0] & mask_begin);
+    t[0] ^= r;
+    __M4RIE_KERNEL_MUL_WORD(r, f[i][n-1] & mask_end);
+    t[n-1] ^= r;
+  }
+
+  if (gf2e_simd_mul_rows(ff, __M4RIE_KERNEL_W, xs, k, t, f, 1, n - 2))
+    return;
+
+  for(wi_t b=1; b<n-1; b+=__M4RIE_KERNEL_BLOCK) {
+    const wi_t e = MIN(b + __M4RIE_KERNEL_BLOCK, n-1);
+    for(int i=0; i<k; i++) {
+      const word x = xs[i];
+      const word *fi = f[i];
+      __M4RIE_KERNEL_INIT(ff, x);
+      for(wi_t j=b; j<e; j++) {
+        __M4RIE_KERNEL_MUL_WORD(r, fi[j]);
+        t[j] ^= r;
+      }
+    }
+  }
+}
+
+#undef __M4RIE_KERNEL_BLOCK
+
+static const mzed_kernels_t __M4RIE_KERNEL(_mzed_kernels) = {
+  __M4RIE_KERNEL(_mzed_add_multiple_of_row),
+  __M4RIE_KERNEL(_mzed_rescale_row),
+  __M4RIE_KERNEL(_mzed_add_multiple_of_rows),
+};
+
+#undef __M4RIE_KERNEL_MUL_WORD
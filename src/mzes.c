@@ -0,0 +1,218 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include "config.h"
+#include "mzes.h"
+
+mzes_t *mzes_init(const gf2e *ff, const rci_t m, const rci_t n, const size_t nnz) {
+  mzes_t *A = (mzes_t*)m4ri_mm_malloc(sizeof(mzes_t));
+
+  A->finite_field = ff;
+  A->nrows = m;
+  A->ncols = n;
+  A->w = gf2e_degree_to_w(ff);
+  A->nnz = nnz;
+
+  const size_t e = m4ri_radix/A->w;
+  A->rowptr = (size_t*)m4ri_mm_calloc(m + 1, sizeof(size_t));
+  A->colidx = (rci_t*)m4ri_mm_malloc(MAX(nnz, 1) * sizeof(rci_t));
+  A->values = (word*)m4ri_mm_calloc((nnz + e - 1)/e + 1, sizeof(word));
+  return A;
+}
+
+void mzes_free(mzes_t *A) {
+  m4ri_mm_free(A->rowptr);
+  m4ri_mm_free(A->colidx);
+  m4ri_mm_free(A->values);
+  m4ri_mm_free(A);
+}
+
+word mzes_read_elem(const mzes_t *A, const rci_t row, const rci_t col) {
+  size_t lo = A->rowptr[row];
+  size_t hi = A->rowptr[row+1];
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo)/2;
+    if (A->colidx[mid] < col)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if (lo < A->rowptr[row+1] && A->colidx[lo] == col)
+    return mzes_read_value(A, lo);
+  return 0;
+}
+
+/**
+ * Count the non-zero elements of row i of A and, if S is not NULL, store them in S starting at
+ * entry k. Zero words are skipped as a whole.
+ */
+
+static size_t _mzes_scan_row(mzes_t *S, size_t k, const mzed_t *A, const rci_t i) {
+  const size_t k0 = k;
+
+  if (A->x->offset) {
+    for(rci_t j=0; j<A->ncols; j++) {
+      const word a = mzed_read_elem(A, i, j);
+      if (a == 0)
+        continue;
+      if (S) {
+        S->colidx[k] = j;
+        mzes_write_value(S, k, a);
+      }
+      k++;
+    }
+    return k - k0;
+  }
+
+  const int e = m4ri_radix/A->w;
+  const word mask = __M4RI_LEFT_BITMASK(A->w);
+  const word *row = A->x->rows[i];
+
+  for(wi_t j=0; j<A->x->width; j++) {
+    word v = row[j];
+    if (j == A->x->width - 1)
+      v &= A->x->high_bitmask;
+    for(int l=0; v; l++, v >>= A->w) {
+      const word a = v & mask;
+      if (a == 0)
+        continue;
+      if (S) {
+        S->colidx[k] = j*e + l;
+        mzes_write_value(S, k, a);
+      }
+      k++;
+    }
+  }
+  return k - k0;
+}
+
+mzes_t *mzes_from_mzed(const mzed_t *A) {
+  size_t nnz = 0;
+  for(rci_t i=0; i<A->nrows; i++)
+    nnz += _mzes_scan_row(NULL, 0, A, i);
+
+  mzes_t *S = mzes_init(A->finite_field, A->nrows, A->ncols, nnz);
+  for(rci_t i=0; i<A->nrows; i++)
+    S->rowptr[i+1] = S->rowptr[i] + _mzes_scan_row(S, S->rowptr[i], A, i);
+  return S;
+}
+
+mzed_t *mzes_to_mzed(mzed_t *C, const mzes_t *A) {
+  if (C == NULL) {
+    C = mzed_init(A->finite_field, A->nrows, A->ncols);
+  } else {
+    if (C->finite_field != A->finite_field || C->nrows != A->nrows || C->ncols != A->ncols)
+      m4ri_die("mzes_to_mzed: rows and columns of returned matrix must match.\n");
+    mzed_set_ui(C, 0);
+  }
+
+  for(rci_t i=0; i<A->nrows; i++)
+    for(size_t k=A->rowptr[i]; k<A->rowptr[i+1]; k++)
+      mzed_write_elem(C, i, A->colidx[k], mzes_read_value(A, k));
+  return C;
+}
+
+mzed_t *mzes_addmul(mzed_t *C, const mzes_t *A, const mzed_t *B) {
+  if (C->finite_field != A->finite_field || A->finite_field != B->finite_field)
+    m4ri_die("mzes_addmul: all matrices must be over the same finite field.\n");
+  if (A->ncols != B->nrows || C->nrows != A->nrows || C->ncols != B->ncols)
+    m4ri_die("mzes_addmul: rows and columns of all matrices must match.\n");
+  if (B->ncols == 0)
+    return C;
+
+  const gf2e *ff = A->finite_field;
+
+  /**
+   * Every row of C is independent and the rows of B it needs are given by colidx, hence we pass
+   * colidx to mzed_add_multiple_of_rows() in chunks of __M4RIE_SIMD_MAX_ROWS unpacked scalars.
+   */
+
+#ifdef HAVE_OPENMP
+#pragma omp parallel for schedule(dynamic, 16) if(A->nnz > __M4RIE_MZES_PARALLEL_CUTOFF)
+#endif
+  for(rci_t i=0; i<A->nrows; i++) {
+    word x[__M4RIE_SIMD_MAX_ROWS];
+    for(size_t k=A->rowptr[i]; k<A->rowptr[i+1]; k+=__M4RIE_SIMD_MAX_ROWS) {
+      const int l = MIN(__M4RIE_SIMD_MAX_ROWS, A->rowptr[i+1] - k);
+      for(int j=0; j<l; j++)
+        x[j] = mzes_read_value(A, k + j);
+
+      if (C->x->offset == B->x->offset) {
+        mzed_add_multiple_of_rows(C, i, B, A->colidx + k, x, l, 0);
+      } else {
+        for(int j=0; j<l; j++)
+          for(rci_t c=0; c<B->ncols; c++)
+            mzed_add_elem(C, i, c, ff->mul(ff, x[j], mzed_read_elem(B, A->colidx[k+j], c)));
+      }
+    }
+  }
+  return C;
+}
+
+mzed_t *mzes_mul(mzed_t *C, const mzes_t *A, const mzed_t *B) {
+  if (C == NULL)
+    C = mzed_init(A->finite_field, A->nrows, B->ncols);
+  else
+    mzed_set_ui(C, 0);
+  return mzes_addmul(C, A, B);
+}
+
+/**
+ * mzes_mul_vector() multiplies this many entries at a time with gf2e_mul_vec().
+ */
+
+#define __M4RIE_MZES_VECTOR_BLOCK 64
+
+mzed_t *mzes_mul_vector(mzed_t *y, const mzes_t *A, const mzed_t *x) {
+  if (x->finite_field != A->finite_field || x->nrows != A->ncols || x->ncols != 1)
+    m4ri_die("mzes_mul_vector: x must be a column vector of length A->ncols over the same field.\n");
+  if (y == NULL)
+    y = mzed_init(A->finite_field, A->nrows, 1);
+  else if (y->finite_field != A->finite_field || y->nrows != A->nrows || y->ncols != 1)
+    m4ri_die("mzes_mul_vector: y must be a column vector of length A->nrows over the same field.\n");
+
+  const gf2e *ff = A->finite_field;
+
+  /** the rows of x are scattered over memory, hence we read them once **/
+  word *xv = (word*)m4ri_mm_malloc(MAX(A->ncols, 1) * sizeof(word));
+  for(rci_t j=0; j<A->ncols; j++)
+    xv[j] = mzed_read_elem(x, j, 0);
+
+#ifdef HAVE_OPENMP
+#pragma omp parallel for schedule(dynamic, 64) if(A->nnz > __M4RIE_MZES_PARALLEL_CUTOFF)
+#endif
+  for(rci_t i=0; i<A->nrows; i++) {
+    word a[__M4RIE_MZES_VECTOR_BLOCK], b[__M4RIE_MZES_VECTOR_BLOCK], c[__M4RIE_MZES_VECTOR_BLOCK];
+    word acc = 0;
+    for(size_t k=A->rowptr[i]; k<A->rowptr[i+1]; k+=__M4RIE_MZES_VECTOR_BLOCK) {
+      const int l = MIN(__M4RIE_MZES_VECTOR_BLOCK, A->rowptr[i+1] - k);
+      for(int j=0; j<l; j++) {
+        a[j] = mzes_read_value(A, k + j);
+        b[j] = xv[A->colidx[k+j]];
+      }
+      gf2e_mul_vec(ff, c, a, b, l);
+      for(int j=0; j<l; j++)
+        acc ^= c[j];
+    }
+    mzed_write_elem(y, i, 0, acc);
+  }
+
+  m4ri_mm_free(xv);
+  return y;
+}
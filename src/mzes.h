@@ -0,0 +1,193 @@
+/**
+ * \file mzes.h
+ *
+ * \brief Sparse matrices over \GF2E in compressed sparse row (CSR) format.
+ *
+ * The non-zero entries of row i are stored in the positions rowptr[i], ..., rowptr[i+1]-1 in
+ * increasing column order. Their column indices are stored in colidx and their values are packed
+ * into words of values with the same width w as in mzed_t, i.e. entry k is bits (k%(64/w))*w, ...
+ * of values[k/(64/w)].
+ *
+ * Products with dense matrices add scaled rows of the dense operand with the row kernels of
+ * mzed_t, hence their cost is proportional to the number of non-zero entries.
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+#ifndef M4RIE_MZES_H
+#define M4RIE_MZES_H
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <m4ri/m4ri.h>
+#include <m4rie/gf2e.h>
+#include <m4rie/mzed.h>
+
+/**
+ * \brief Sparse matrices over \GF2E in compressed sparse row format.
+ *
+ * \ingroup Definitions
+ */
+
+typedef struct {
+  const gf2e *finite_field; /**< A finite field \GF2E. */
+  rci_t nrows; /**< Number of rows. */
+  rci_t ncols; /**< Number of columns. */
+  wi_t w;      /**< The width of packed values, as in mzed_t. */
+  size_t nnz;  /**< Number of stored entries. */
+  size_t *rowptr; /**< nrows+1 offsets, the entries of row i are rowptr[i], ..., rowptr[i+1]-1. */
+  rci_t *colidx;  /**< Column index of every entry, increasing in every row. */
+  word *values;   /**< Packed values of the entries. */
+} mzes_t;
+
+/**
+ * Products are computed in parallel if the matrix has more than this many stored entries.
+ */
+
+#define __M4RIE_MZES_PARALLEL_CUTOFF (1<<12)
+
+/**
+ * \brief Create an m x n sparse matrix over ff with space for nnz entries.
+ *
+ * rowptr is zero, i.e. all rows are empty until rowptr, colidx and values are filled by the
+ * caller.
+ *
+ * \param ff Finite field.
+ * \param m Number of rows.
+ * \param n Number of columns.
+ * \param nnz Number of entries.
+ *
+ * \ingroup Constructions
+ */
+
+mzes_t *mzes_init(const gf2e *ff, const rci_t m, const rci_t n, const size_t nnz);
+
+/**
+ * \brief Free a matrix created with mzes_init() or mzes_from_mzed().
+ *
+ * \param A Matrix.
+ *
+ * \ingroup Constructions
+ */
+
+void mzes_free(mzes_t *A);
+
+/**
+ * \brief Return the value of the k-th stored entry of A.
+ *
+ * \param A Matrix.
+ * \param k Index with k < A->nnz.
+ *
+ * \ingroup Assignment
+ */
+
+static inline word mzes_read_value(const mzes_t *A, const size_t k) {
+  const size_t e = m4ri_radix/A->w;
+  return (A->values[k/e] >> ((k%e)*A->w)) & __M4RI_LEFT_BITMASK(A->w);
+}
+
+/**
+ * \brief Set the value of the k-th stored entry of A to elem.
+ *
+ * \param A Matrix.
+ * \param k Index with k < A->nnz.
+ * \param elem Finite field element.
+ *
+ * \ingroup Assignment
+ */
+
+static inline void mzes_write_value(mzes_t *A, const size_t k, const word elem) {
+  const size_t e = m4ri_radix/A->w;
+  const int shift = (k%e)*A->w;
+  A->values[k/e] = (A->values[k/e] & ~(__M4RI_LEFT_BITMASK(A->w) << shift)) | (elem << shift);
+}
+
+/**
+ * \brief Get the element at position (row,col) from the matrix A.
+ *
+ * The column is found by binary search in the row.
+ *
+ * \param A Matrix.
+ * \param row Row index.
+ * \param col Column index.
+ *
+ * \ingroup Assignment
+ */
+
+word mzes_read_elem(const mzes_t *A, const rci_t row, const rci_t col);
+
+/**
+ * \brief Return the non-zero entries of A as a sparse matrix.
+ *
+ * \param A Matrix.
+ *
+ * \ingroup Constructions
+ */
+
+mzes_t *mzes_from_mzed(const mzed_t *A);
+
+/**
+ * \brief Copy A to the dense matrix C.
+ *
+ * \param C Dense matrix or NULL.
+ * \param A Sparse matrix.
+ *
+ * \ingroup Assignment
+ */
+
+mzed_t *mzes_to_mzed(mzed_t *C, const mzes_t *A);
+
+/**
+ * \brief C = A*B for a sparse matrix A and a dense matrix B.
+ *
+ * \param C Preallocated product matrix, may be NULL for automatic creation.
+ * \param A Sparse input matrix A.
+ * \param B Input matrix B.
+ *
+ * \ingroup Multiplication
+ */
+
+mzed_t *mzes_mul(mzed_t *C, const mzes_t *A, const mzed_t *B);
+
+/**
+ * \brief C = C + A*B for a sparse matrix A and a dense matrix B.
+ *
+ * \param C Preallocated product matrix.
+ * \param A Sparse input matrix A.
+ * \param B Input matrix B.
+ *
+ * \ingroup Multiplication
+ */
+
+mzed_t *mzes_addmul(mzed_t *C, const mzes_t *A, const mzed_t *B);
+
+/**
+ * \brief y = A*x for a sparse matrix A and a column vector x.
+ *
+ * \param y Preallocated A->nrows x 1 matrix, may be NULL for automatic creation.
+ * \param A Sparse input matrix A.
+ * \param x A->ncols x 1 matrix.
+ *
+ * \ingroup Multiplication
+ */
+
+mzed_t *mzes_mul_vector(mzed_t *y, const mzes_t *A, const mzed_t *x);
+
+#endif //M4RIE_MZES_H
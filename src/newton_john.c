@@ -28,11 +28,23 @@
 #include "trsm.h"
 #include "ple.h"
 #include "conversion.h"
+#include "dispatch.h"
 
 njt_mzed_t *njt_mzed_init(const gf2e *ff, const rci_t ncols) {
+  if (ff->degree > M4RIE_MAX_TABLE_DEGREE)
+    m4ri_die("Newton-John tables are only supported for degree <= %d.\n", M4RIE_MAX_TABLE_DEGREE);
   njt_mzed_t *T =  m4ri_mm_malloc(sizeof(njt_mzed_t));
-  T->L = (rci_t*)m4ri_mm_calloc(__M4RI_TWOPOW(ff->degree), sizeof(rci_t));
-  T->T = mzed_init(ff, __M4RI_TWOPOW(ff->degree), ncols);
+  if (ff->degree > M4RIE_NJT_SPLIT_DEGREE) {
+    T->L = (rci_t*)m4ri_mm_calloc(__M4RI_TWOPOW(M4RIE_NJT_SPLIT_DEGREE), sizeof(rci_t));
+    T->T = mzed_init(ff, __M4RI_TWOPOW(M4RIE_NJT_SPLIT_DEGREE), ncols);
+    T->L1 = (rci_t*)m4ri_mm_calloc(__M4RI_TWOPOW(ff->degree - M4RIE_NJT_SPLIT_DEGREE), sizeof(rci_t));
+    T->T1 = mzed_init(ff, __M4RI_TWOPOW(ff->degree - M4RIE_NJT_SPLIT_DEGREE), ncols);
+  } else {
+    T->L = (rci_t*)m4ri_mm_calloc(__M4RI_TWOPOW(ff->degree), sizeof(rci_t));
+    T->T = mzed_init(ff, __M4RI_TWOPOW(ff->degree), ncols);
+    T->L1 = NULL;
+    T->T1 = NULL;
+  }
   T->M = mzed_init(ff, ff->degree, ncols);
   return T;
 }
@@ -41,9 +53,123 @@ void njt_mzed_free(njt_mzed_t *T) {
   mzed_free(T->M);
   mzed_free(T->T);
   m4ri_mm_free(T->L);
+  if (T->T1) {
+    mzed_free(T->T1);
+    m4ri_mm_free(T->L1);
+  }
   m4ri_mm_free(T);
 }
 
+/**
+ * Tables returned by njt_mzed_release(), most recently released first.
+ */
+
+typedef struct njt_mzed_pool_struct {
+  njt_mzed_t *T;
+  size_t size;  /**< Bytes held by T. */
+  struct njt_mzed_pool_struct *next;
+} njt_mzed_pool_t;
+
+static njt_mzed_pool_t *njt_mzed_pool = NULL;
+
+static size_t _njt_mzed_size(const njt_mzed_t *T) {
+  const rci_t rows = T->T->nrows + (T->T1 ? T->T1->nrows : 0);
+  return (size_t)(rows + T->M->nrows) * T->T->x->width * sizeof(word) + rows * sizeof(rci_t);
+}
+
+njt_mzed_t *njt_mzed_get(const gf2e *ff, const rci_t ncols) {
+  njt_mzed_pool_t *p = NULL;
+#ifdef HAVE_OPENMP
+#pragma omp critical (njt_mzed_pool)
+#endif
+  {
+    njt_mzed_pool_t **e = &njt_mzed_pool;
+    while(*e != NULL && ((*e)->T->T->finite_field != ff || (*e)->T->T->ncols != ncols))
+      e = &(*e)->next;
+    p = *e;
+    if (p != NULL)
+      *e = p->next;
+  }
+
+  if (p == NULL)
+    return njt_mzed_init(ff, ncols);
+  njt_mzed_t *T = p->T;
+  m4ri_mm_free(p);
+  return T;
+}
+
+/**
+ * Free all tables for ff, registered with gf2e_on_free() by njt_mzed_release().
+ */
+
+static void _njt_mzed_forget(const gf2e *ff) {
+#ifdef HAVE_OPENMP
+#pragma omp critical (njt_mzed_pool)
+#endif
+  {
+    njt_mzed_pool_t **e = &njt_mzed_pool;
+    while(*e != NULL) {
+      njt_mzed_pool_t *p = *e;
+      if (p->T->T->finite_field == ff) {
+        *e = p->next;
+        njt_mzed_free(p->T);
+        m4ri_mm_free(p);
+      } else {
+        e = &p->next;
+      }
+    }
+  }
+}
+
+void njt_mzed_release(njt_mzed_t *T) {
+  njt_mzed_pool_t *p = (njt_mzed_pool_t*)m4ri_mm_malloc(sizeof(njt_mzed_pool_t));
+  p->T = T;
+  p->size = _njt_mzed_size(T);
+
+#ifdef HAVE_OPENMP
+#pragma omp critical (njt_mzed_pool)
+#endif
+  {
+    static int hooked = 0;
+    if (!hooked) {
+      gf2e_on_free(_njt_mzed_forget);
+      hooked = 1;
+    }
+
+    p->next = njt_mzed_pool;
+    njt_mzed_pool = p;
+
+    /** evict the least recently released tables **/
+    size_t size = 0;
+    njt_mzed_pool_t **e = &njt_mzed_pool;
+    while(*e != NULL) {
+      p = *e;
+      size += p->size;
+      if (size > M4RIE_NJT_CACHE_SIZE) {
+        *e = p->next;
+        njt_mzed_free(p->T);
+        m4ri_mm_free(p);
+      } else {
+        e = &p->next;
+      }
+    }
+  }
+}
+
+void njt_mzed_clear(void) {
+#ifdef HAVE_OPENMP
+#pragma omp critical (njt_mzed_pool)
+#endif
+  {
+    while(njt_mzed_pool != NULL) {
+      njt_mzed_pool_t *p = njt_mzed_pool;
+      njt_mzed_pool = p->next;
+      njt_mzed_free(p->T);
+      m4ri_mm_free(p);
+    }
+  }
+}
+
 /**
  * Compute C[rc,i] = C[rc,i] + T0[r0,i] + ... + T3[r3,i] for 0 <= i < ncols
  *
@@ -63,9 +189,9 @@ void njt_mzed_free(njt_mzed_t *T) {
 
 static inline void mzed_combine4(mzed_t *C, rci_t rc, 
                                  mzed_t *T0, rci_t r0, mzed_t *T1, rci_t r1, mzed_t *T2, rci_t r2, mzed_t *T3, rci_t r3) {
-  _mzd_combine4(C->x->rows[rc], 
-                T0->x->rows[r0], T1->x->rows[r1], T2->x->rows[r2], T3->x->rows[r3], 
-                C->x->width);
+  m4rie_dispatch()->combine4(C->x->rows[rc],
+                            T0->x->rows[r0], T1->x->rows[r1], T2->x->rows[r2], T3->x->rows[r3],
+                            C->x->width);
 }
 
 /**
@@ -96,10 +222,10 @@ static inline void mzed_combine4(mzed_t *C, rci_t rc,
 static inline void mzed_combine8(mzed_t *C, rci_t rc, 
                                  mzed_t *T0, rci_t r0, mzed_t *T1, rci_t r1, mzed_t *T2, rci_t r2, mzed_t *T3, rci_t r3,
                                  mzed_t *T4, rci_t r4, mzed_t *T5, rci_t r5, mzed_t *T6, rci_t r6, mzed_t *T7, rci_t r7) {
-  _mzd_combine8(C->x->rows[rc], 
-                T0->x->rows[r0], T1->x->rows[r1], T2->x->rows[r2], T3->x->rows[r3], 
-                T4->x->rows[r4], T5->x->rows[r5], T6->x->rows[r6], T7->x->rows[r7], 
-                C->x->width);
+  m4rie_dispatch()->combine8(C->x->rows[rc],
+                            T0->x->rows[r0], T1->x->rows[r1], T2->x->rows[r2], T3->x->rows[r3],
+                            T4->x->rows[r4], T5->x->rows[r5], T6->x->rows[r6], T7->x->rows[r7],
+                            C->x->width);
 }
 
 
@@ -126,14 +252,19 @@ rci_t _mzed_gauss_submatrix_full(mzed_t *A, const rci_t r, const rci_t c, const
   word tmp;
 
   const gf2e *ff = A->finite_field;
+  rci_t *rows = (rci_t*)m4ri_mm_malloc(k * sizeof(rci_t));
+  word *scalars = (word*)m4ri_mm_malloc(k * sizeof(word));
 
   for (j=c; j<c+k; j++) {
     found = 0;
     for (i=start_row; i< end_row; i++) {
-      /* first we need to clear the first columns */
-      for (l=0; l<j-c; l++) {
-        tmp = mzed_read_elem(A, i, c+l);
-        if (tmp) mzed_add_multiple_of_row(A, i, A, r+l, tmp, c+l);
+      /* first we need to clear the first columns, rows r..start_row-1 are the identity on them */
+      if (j > c) {
+        for (l=0; l<j-c; l++) {
+          rows[l] = r+l;
+          scalars[l] = mzed_read_elem(A, i, c+l);
+        }
+        mzed_add_multiple_of_rows(A, i, A, rows, scalars, j-c, c);
       }
       /* pivot? */
       const word x = mzed_read_elem(A, i, j);
@@ -152,49 +283,34 @@ rci_t _mzed_gauss_submatrix_full(mzed_t *A, const rci_t r, const rci_t c, const
       }
     }
     if (found==0) {
-      return j - c;
+      break;
     }
   }
+  m4ri_mm_free(rows);
+  m4ri_mm_free(scalars);
   return j - c;
 }
 
 
-njt_mzed_t *mzed_make_table(njt_mzed_t *T, const mzed_t *A, const rci_t r, const rci_t c) {
-  assert(m4ri_radix > A->finite_field->degree);
-  if (T == NULL)
-    T = njt_mzed_init(A->finite_field, A->ncols);
-
-  mzd_set_ui(T->M->x,0);
-
-#if 0
-  for(rci_t i=0; i< T->T->nrows; i+=2) {
-    T->L[i] = i;
-    mzed_add_multiple_of_row(T->T, i, A, r, A->finite_field->mul[i], c);
+/**
+ * Fill TT with the 2^k linear combinations of the rows first, ..., first+k-1 of M in Gray code
+ * order and L with their positions, starting at word homeblock.
+ */
 
-    T->L[i+1] = i+1;
-    mzed_copy_row(T->T, i+1, T->T, i);
-    mzed_add_row(T->T, i+1, A, r, c);
-  }
-#else  
-  const int degree = A->finite_field->degree;
-  const wi_t homeblock = (A->w*c + A->x->offset) / m4ri_radix;
-  const wi_t wide = T->M->x->width - homeblock;
-  const word bitmask_end = __M4RI_LEFT_BITMASK((T->M->x->offset + T->M->x->ncols) % m4ri_radix);
+static void _mzed_make_table_gray(mzed_t *TT, rci_t *L, const mzed_t *M, const int first, const int k,
+                                  const wi_t homeblock, const word bitmask_end) {
+  const wi_t wide = M->x->width - homeblock;
   wi_t j;
 
-  for(int i=0; i<degree; i++) {
-    mzed_add_multiple_of_row(T->M, i, A, r, 1ULL<<i, c);
-  }
-
-  for(rci_t i=1; i < T->T->nrows; ++i) {
-    word *ti = T->T->x->rows[i] + homeblock;
-    word *ti1 = T->T->x->rows[i-1] + homeblock;
+  for(rci_t i=1; i < TT->nrows; ++i) {
+    word *ti = TT->x->rows[i] + homeblock;
+    word *ti1 = TT->x->rows[i-1] + homeblock;
 
-    const rci_t rowneeded = m4ri_codebook[degree]->inc[i - 1];
-    const int id = m4ri_codebook[degree]->ord[i];
-    T->L[id] = i;
+    const rci_t rowneeded = first + m4ri_codebook[k]->inc[i - 1];
+    const int id = m4ri_codebook[k]->ord[i];
+    L[id] = i;
 
-    word *m = T->M->x->rows[rowneeded] + homeblock;
+    const word *m = M->x->rows[rowneeded] + homeblock;
 
     /* there might still be stuff left over from the previous table creation,
        here we assume that this is at most 8 * m4ri_radix bits away. */
@@ -233,14 +349,109 @@ njt_mzed_t *mzed_make_table(njt_mzed_t *T, const mzed_t *A, const rci_t r, const
     case 1:  *ti++ = (*m++ ^ *ti1++) & bitmask_end;
     }
   }
+}
+
+njt_mzed_t *mzed_make_table(njt_mzed_t *T, const mzed_t *A, const rci_t r, const rci_t c) {
+  assert(m4ri_radix > A->finite_field->degree);
+  if (T == NULL)
+    T = njt_mzed_init(A->finite_field, A->ncols);
+
+  mzd_set_ui(T->M->x,0);
+
+#if 0
+  for(rci_t i=0; i< T->T->nrows; i+=2) {
+    T->L[i] = i;
+    mzed_add_multiple_of_row(T->T, i, A, r, A->finite_field->mul[i], c);
+
+    T->L[i+1] = i+1;
+    mzed_copy_row(T->T, i+1, T->T, i);
+    mzed_add_row(T->T, i+1, A, r, c);
+  }
+#else  
+  const int degree = A->finite_field->degree;
+  const wi_t homeblock = (A->w*c + A->x->offset) / m4ri_radix;
+  const word bitmask_end = __M4RI_LEFT_BITMASK((T->M->x->offset + T->M->x->ncols) % m4ri_radix);
+
+  for(int i=0; i<degree; i++) {
+    mzed_add_multiple_of_row(T->M, i, A, r, 1ULL<<i, c);
+  }
+
+  if (T->T1 == NULL) {
+    _mzed_make_table_gray(T->T, T->L, T->M, 0, degree, homeblock, bitmask_end);
+  } else {
+    _mzed_make_table_gray(T->T, T->L, T->M, 0, M4RIE_NJT_SPLIT_DEGREE, homeblock, bitmask_end);
+    _mzed_make_table_gray(T->T1, T->L1, T->M, M4RIE_NJT_SPLIT_DEGREE, degree - M4RIE_NJT_SPLIT_DEGREE, homeblock, bitmask_end);
+  }
 #endif
 
   return T;
 }
 
+void _mzed_process_rows_split(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol,
+                              const njt_mzed_t *const *T, const int k) {
+  /**
+   * The lower half of a table is applied first, which leaves the upper bits of the element at
+   * startcol unchanged, hence every table reads M4RIE_NJT_SPLIT_DEGREE = w/2 bits twice.
+   */
+  const rci_t h = M->w/2;
+  for(int i=0; i<k; i+=3) {
+    const rci_t c = (startcol + i)*M->w;
+    switch(MIN(k - i, 3)) {
+    case 1:
+      mzd_process_rows2(M->x, startrow, endrow, c, 2*h,
+                        T[i]->T->x, T[i]->L, T[i]->T1->x, T[i]->L1);
+      break;
+    case 2:
+      mzd_process_rows4(M->x, startrow, endrow, c, 4*h,
+                        T[i]->T->x, T[i]->L, T[i]->T1->x, T[i]->L1, T[i+1]->T->x, T[i+1]->L, T[i+1]->T1->x, T[i+1]->L1);
+      break;
+    case 3:
+      mzd_process_rows6(M->x, startrow, endrow, c, 6*h,
+                        T[i]->T->x, T[i]->L, T[i]->T1->x, T[i]->L1, T[i+1]->T->x, T[i+1]->L, T[i+1]->T1->x, T[i+1]->L1,
+                        T[i+2]->T->x, T[i+2]->L, T[i+2]->T1->x, T[i+2]->L1);
+      break;
+    }
+  }
+}
+
+static void _mzed_process_rows(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol,
+                               const njt_mzed_t *const *T, const int k) {
+  switch(k) {
+  case 1: mzed_process_rows (M, startrow, endrow, startcol, T[0]); break;
+  case 2: mzed_process_rows2(M, startrow, endrow, startcol, T[0], T[1]); break;
+  case 3: mzed_process_rows3(M, startrow, endrow, startcol, T[0], T[1], T[2]); break;
+  case 4: mzed_process_rows4(M, startrow, endrow, startcol, T[0], T[1], T[2], T[3]); break;
+  case 5: mzed_process_rows5(M, startrow, endrow, startcol, T[0], T[1], T[2], T[3], T[4]); break;
+  case 6: mzed_process_rows6(M, startrow, endrow, startcol, T[0], T[1], T[2], T[3], T[4], T[5]); break;
+  default:
+    m4ri_die("mzed_process_rows_mp: k must be between 1 and 6 but got %d.\n", k);
+  }
+}
+
+void mzed_process_rows_mp(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol,
+                          const njt_mzed_t *const *T, const int k) {
+  if (startrow >= endrow)
+    return;
+
+#ifdef HAVE_OPENMP
+  /** every row only depends on itself and the tables, hence blocks of rows are independent **/
+  const wi_t words = M->x->width - (M->x->offset + startcol*M->w)/m4ri_radix;
+  if (endrow - startrow > __M4RIE_PROCESS_ROWS_BLOCK && (size_t)(endrow - startrow)*words > __M4RIE_PROCESS_ROWS_PARALLEL_CUTOFF) {
+#pragma omp parallel for schedule(static)
+    for(rci_t i=startrow; i<endrow; i+=__M4RIE_PROCESS_ROWS_BLOCK)
+      _mzed_process_rows(M, i, MIN(i + __M4RIE_PROCESS_ROWS_BLOCK, endrow), startcol, T, k);
+    return;
+  }
+#endif
+  _mzed_process_rows(M, startrow, endrow, startcol, T, k);
+}
+
 rci_t mzed_echelonize_newton_john(mzed_t *A, int full) {
   const gf2e* ff = A->finite_field;
 
+  if (ff->degree > M4RIE_MAX_TABLE_DEGREE)
+    return mzed_echelonize_naive(A, full);
+
   rci_t r,c;
 
   rci_t k = ff->degree;
@@ -261,12 +472,9 @@ rci_t mzed_echelonize_newton_john(mzed_t *A, int full) {
 
   rci_t kbar = 0;
 
-  njt_mzed_t *T0 = njt_mzed_init(ff, A->ncols);
-  njt_mzed_t *T1 = njt_mzed_init(ff, A->ncols);
-  njt_mzed_t *T2 = njt_mzed_init(ff, A->ncols);
-  njt_mzed_t *T3 = njt_mzed_init(ff, A->ncols);
-  njt_mzed_t *T4 = njt_mzed_init(ff, A->ncols);
-  njt_mzed_t *T5 = njt_mzed_init(ff, A->ncols);
+  njt_mzed_t *T[6];
+  for(int i=0; i<6; i++)
+    T[i] = njt_mzed_get(ff, A->ncols);
 
   r = 0;
   c = 0;
@@ -280,62 +488,13 @@ rci_t mzed_echelonize_newton_john(mzed_t *A, int full) {
      */
     kbar = _mzed_gauss_submatrix_full(A, r, c, A->nrows, kk);
 
-    if (kbar == 6)  {
-      mzed_make_table(T0, A, r,   c);
-      mzed_make_table(T1, A, r+1, c+1);
-      mzed_make_table(T2, A, r+2, c+2);
-      mzed_make_table(T3, A, r+3, c+3);
-      mzed_make_table(T4, A, r+4, c+4);
-      mzed_make_table(T5, A, r+5, c+5);
-      if(kbar == kk)
-        mzed_process_rows6( A, r+6, A->nrows, c, T0, T1, T2, T3, T4, T5);
-      if(full)
-        mzed_process_rows6( A,   0,        r, c, T0, T1, T2, T3, T4, T5);
-    } else if(kbar == 5) {
-      mzed_make_table(T0, A, r,     c);
-      mzed_make_table(T1, A, r+1, c+1);
-      mzed_make_table(T2, A, r+2, c+2);
-      mzed_make_table(T3, A, r+3, c+3);
-      mzed_make_table(T4, A, r+4, c+4);
-      if(kbar == kk)
-        mzed_process_rows5( A, r+5, A->nrows, c, T0, T1, T2, T3, T4);
-      if(full)
-        mzed_process_rows5( A,   0,        r, c, T0, T1, T2, T3, T4);
-
-    } else if(kbar == 4) {
-      mzed_make_table(T0, A, r,   c);
-      mzed_make_table(T1, A, r+1, c+1);
-      mzed_make_table(T2, A, r+2, c+2);
-      mzed_make_table(T3, A, r+3, c+3);
-      if(kbar == kk)
-        mzed_process_rows4( A, r+4, A->nrows, c, T0, T1, T2, T3);
-      if(full)
-        mzed_process_rows4( A,   0,        r, c, T0, T1, T2, T3);
-
-    } else if(kbar == 3) {
-      mzed_make_table(T0,  A, r,   c );
-      mzed_make_table(T1,  A, r+1, c+1);
-      mzed_make_table(T2,  A, r+2, c+2);
+    if (kbar > 0) {
+      for(int i=0; i<kbar; i++)
+        mzed_make_table(T[i], A, r+i, c+i);
       if(kbar == kk)
-        mzed_process_rows3( A, r+3, A->nrows, c, T0, T1, T2);
+        mzed_process_rows_mp(A, r+kbar, A->nrows, c, (const njt_mzed_t *const *)T, kbar);
       if(full)
-        mzed_process_rows3( A,   0,        r, c, T0, T1, T2);
-
-    } else if(kbar == 2) {
-      mzed_make_table(T0, A, r,   c );
-      mzed_make_table(T1, A, r+1, c+1);
-      if(kbar == kk)
-        mzed_process_rows2( A, r+2, A->nrows, c, T0, T1);
-      if(full)
-        mzed_process_rows2( A,   0,        r, c, T0, T1);
-
-    } else if (kbar == 1) {
-      mzed_make_table(T0, A, r, c);
-      if(kbar == kk)
-        mzed_process_rows( A, r+1, A->nrows, c, T0);
-      if(full)
-        mzed_process_rows( A,   0,        r, c, T0);
-
+        mzed_process_rows_mp(A,      0,        r, c, (const njt_mzed_t *const *)T, kbar);
     } else {
       c++;
     }
@@ -343,12 +502,8 @@ rci_t mzed_echelonize_newton_john(mzed_t *A, int full) {
     c += kbar;
   }
 
-  njt_mzed_free(T0);
-  njt_mzed_free(T1);
-  njt_mzed_free(T2);
-  njt_mzed_free(T3);
-  njt_mzed_free(T4);
-  njt_mzed_free(T5);
+  for(int i=0; i<6; i++)
+    njt_mzed_release(T[i]);
   return r;
 }
 
@@ -360,7 +515,10 @@ rci_t mzed_ple_newton_john(mzed_t *A, mzp_t *P, mzp_t *Q) {
   rci_t i,j;
   int found = 0;
 
-  njt_mzed_t *T0 = njt_mzed_init(A->finite_field, A->ncols);
+  if (ff->degree > M4RIE_MAX_TABLE_DEGREE)
+    return mzed_ple_naive(A, P, Q);
+
+  njt_mzed_t *T0 = njt_mzed_get(A->finite_field, A->ncols);
 
   while (row_pos < A->nrows && col_pos < A->ncols) {
     found = 0;
@@ -382,7 +540,7 @@ rci_t mzed_ple_newton_john(mzed_t *A, mzp_t *P, mzp_t *Q) {
       if (j+1 < A->ncols) {
         mzed_rescale_row(A, row_pos, j+1, gf2e_inv(ff, tmp));
         mzed_make_table(T0, A, row_pos, j+1);
-        mzed_process_rows(A, row_pos+1, A->nrows, j, T0);
+        mzed_process_rows_mp(A, row_pos+1, A->nrows, j, (const njt_mzed_t *const *)&T0, 1);
       }
       row_pos++;
       col_pos = j + 1;
@@ -397,106 +555,203 @@ rci_t mzed_ple_newton_john(mzed_t *A, mzp_t *P, mzp_t *Q) {
   for (rci_t i=0; i < row_pos; i++) {
     mzed_col_swap_in_rows(A, i, Q->values[i], i, A->nrows);
   }
-  njt_mzed_free(T0);
+  njt_mzed_release(T0);
 
   return row_pos;
 }
 
+/**
+ * C[j] = C[j] + x*r where T was made for the row r, starting at column 0.
+ */
+
+static inline void _mzd_combine_njt(mzd_t *C, const rci_t j, const njt_mzed_t *T, const word x) {
+  if (T->T1 == NULL) {
+    mzd_combine(C, j, 0, C, j, 0, T->T->x, T->L[x], 0);
+    return;
+  }
+  mzd_combine(C, j, 0, C, j, 0, T->T->x, T->L[x & __M4RI_LEFT_BITMASK(M4RIE_NJT_SPLIT_DEGREE)], 0);
+  mzd_combine(C, j, 0, C, j, 0, T->T1->x, T->L1[x >> M4RIE_NJT_SPLIT_DEGREE], 0);
+}
+
 mzed_t *_mzed_mul_newton_john0(mzed_t *C, const mzed_t *A, const mzed_t *B) {
 
-  njt_mzed_t *T0 = njt_mzed_init(B->finite_field, B->ncols);
+  njt_mzed_t *T0 = njt_mzed_get(B->finite_field, B->ncols);
 
   for(rci_t i=0; i < A->ncols; i++) {
     mzed_make_table(T0, B, i, 0);
     for(rci_t j=0; j<A->nrows; j++)
-      mzd_combine(C->x, j, 0, C->x, j, 0, T0->T->x, T0->L[mzed_read_elem(A, j, i)], 0);
+      _mzd_combine_njt(C->x, j, T0, mzed_read_elem(A, j, i));
   }
-  njt_mzed_free(T0);
+  njt_mzed_release(T0);
   return C;
 }
 
-mzed_t *_mzed_mul_newton_john(mzed_t *C, const mzed_t *A, const mzed_t *B) {
-  if (A->finite_field->degree > A->nrows)
-    return _mzed_mul_naive(C, A, B);
+/**
+ * Prefetch the word at p for reading.
+ */
+
+#if defined(__GNUC__)
+#define __M4RIE_PREFETCH(p) __builtin_prefetch((p), 0, 3)
+#else
+#define __M4RIE_PREFETCH(p) ((void)(p))
+#endif
+
+/**
+ * Words per cache line.
+ */
+
+#define __M4RIE_CACHE_LINE_WORDS 8
+
+/**
+ * Write the eight rows of the tables T to be added to row j of C for the columns kk*i, ...,
+ * kk*i+kk-1 of A to x, i.e. two rows per table if the tables are split.
+ */
+
+static inline void _mzed_mul_newton_john_rows(rci_t *x, const njt_mzed_t *const *T, const rci_t kk,
+                                              const mzed_t *A, const rci_t j, const rci_t i) {
+  if (kk == 4) {
+    for(int t=0; t<4; t++) {
+      const word a = mzed_read_elem(A, j, kk*i+t);
+      x[2*t  ] = T[t]->L [a & __M4RI_LEFT_BITMASK(M4RIE_NJT_SPLIT_DEGREE)];
+      x[2*t+1] = T[t]->L1[a >> M4RIE_NJT_SPLIT_DEGREE];
+    }
+  } else {
+    for(int t=0; t<8; t++)
+      x[t] = T[t]->L[mzed_read_elem(A, j, kk*i+t)];
+  }
+}
+
+/**
+ * C += A*B for one stripe of columns of B and C, with kk tables of B->ncols columns.
+ */
 
-  njt_mzed_t *T0 = njt_mzed_init(B->finite_field, B->ncols);
-  njt_mzed_t *T1 = njt_mzed_init(B->finite_field, B->ncols);
-  njt_mzed_t *T2 = njt_mzed_init(B->finite_field, B->ncols);
-  njt_mzed_t *T3 = njt_mzed_init(B->finite_field, B->ncols);
-  njt_mzed_t *T4 = njt_mzed_init(B->finite_field, B->ncols);
-  njt_mzed_t *T5 = njt_mzed_init(B->finite_field, B->ncols);
-  njt_mzed_t *T6 = njt_mzed_init(B->finite_field, B->ncols);
-  njt_mzed_t *T7 = njt_mzed_init(B->finite_field, B->ncols);
-  
-  const rci_t kk = 8;
+static void _mzed_mul_newton_john_stripe(mzed_t *C, const mzed_t *A, const mzed_t *B, njt_mzed_t **T, const rci_t kk) {
   const rci_t end = A->ncols/kk;
 
+  /** the eight tables read by mzed_combine8(), two per table if the tables are split **/
+  mzed_t *TT[8];
+  for(int t=0; t<8; t++)
+    TT[t] = (kk == 4) ? ((t & 1) ? T[t/2]->T1 : T[t/2]->T) : T[t]->T;
+
   rci_t blocksize = 1ULL<<30;
 
   if (A->nrows >= A->w*__M4RI_MUL_BLOCKSIZE) 
     blocksize = __M4RI_MUL_BLOCKSIZE/A->w; 
 
-  rci_t giantstep, babystep;
-
-  for (giantstep=0; giantstep + blocksize <= A->nrows; giantstep += blocksize) {
-    for(rci_t i=0; i < end; i++) {
-      mzed_make_table(T0, B, kk*i  , 0);
-      mzed_make_table(T1, B, kk*i+1, 0);
-      mzed_make_table(T2, B, kk*i+2, 0);
-      mzed_make_table(T3, B, kk*i+3, 0);
-      mzed_make_table(T4, B, kk*i+4, 0);
-      mzed_make_table(T5, B, kk*i+5, 0);
-      mzed_make_table(T6, B, kk*i+6, 0);
-      mzed_make_table(T7, B, kk*i+7, 0);
-      for(babystep = 0; babystep < blocksize; babystep++) {
-        const rci_t j = giantstep + babystep;
-        const rci_t x0 = T0->L[mzed_read_elem(A, j, kk*  i)];
-        const rci_t x1 = T1->L[mzed_read_elem(A, j, kk*i+1)];
-        const rci_t x2 = T2->L[mzed_read_elem(A, j, kk*i+2)];
-        const rci_t x3 = T3->L[mzed_read_elem(A, j, kk*i+3)];
-        const rci_t x4 = T4->L[mzed_read_elem(A, j, kk*i+4)];
-        const rci_t x5 = T5->L[mzed_read_elem(A, j, kk*i+5)];
-        const rci_t x6 = T6->L[mzed_read_elem(A, j, kk*i+6)];
-        const rci_t x7 = T7->L[mzed_read_elem(A, j, kk*i+7)];
-        mzed_combine8(C, j, T0->T, x0, T1->T, x1, T2->T, x2, T3->T, x3, T4->T, x4, T5->T, x5, T6->T, x6, T7->T, x7);
+  /**
+   * For every giant step and group of kk columns of A the kk tables are built once, one
+   * table per thread, and then the rows of the giant step, i.e. disjoint rows of C, are split
+   * among the threads. The implicit barriers of the worksharing loops separate both phases.
+   *
+   * The table rows for row j+1 of C are prefetched while row j is computed.
+   */
+
+#ifdef HAVE_OPENMP
+#pragma omp parallel if((size_t)A->nrows * A->ncols * C->x->width > __M4RIE_NJ_MUL_PARALLEL_CUTOFF)
+#endif
+  {
+    rci_t x[8], y[8];
+    rci_t next = -1;
+
+    for (rci_t giantstep=0; giantstep < A->nrows; giantstep += blocksize) {
+      const rci_t stop = MIN(giantstep + blocksize, A->nrows);
+
+      for(rci_t i=0; i < end; i++) {
+#ifdef HAVE_OPENMP
+#pragma omp for schedule(static, 1)
+#endif
+        for(int t=0; t<kk; t++)
+          mzed_make_table(T[t], B, kk*i+t, 0);
+
+#ifdef HAVE_OPENMP
+#pragma omp for schedule(static)
+#endif
+        for(rci_t j=giantstep; j<stop; j++) {
+          /** the rows of a thread are contiguous, hence x was mostly computed in the last iteration **/
+          if (next != j)
+            _mzed_mul_newton_john_rows(x, (const njt_mzed_t *const *)T, kk, A, j, i);
+          if (j+1 < stop) {
+            _mzed_mul_newton_john_rows(y, (const njt_mzed_t *const *)T, kk, A, j+1, i);
+            for(int t=0; t<8; t++)
+              __M4RIE_PREFETCH(TT[t]->x->rows[y[t]]);
+          }
+          mzed_combine8(C, j, TT[0], x[0], TT[1], x[1], TT[2], x[2], TT[3], x[3],
+                              TT[4], x[4], TT[5], x[5], TT[6], x[6], TT[7], x[7]);
+          if (j+1 < stop) {
+            for(int t=0; t<8; t++)
+              x[t] = y[t];
+            next = j+1;
+          }
+        }
+        next = -1;
       }
     }
-  }
 
-  /* last giant step */
-  for(rci_t i=0; i < end; i++) {
-    mzed_make_table(T0, B, kk*i  , 0);
-    mzed_make_table(T1, B, kk*i+1, 0);
-    mzed_make_table(T2, B, kk*i+2, 0);
-    mzed_make_table(T3, B, kk*i+3, 0);
-    mzed_make_table(T4, B, kk*i+4, 0);
-    mzed_make_table(T5, B, kk*i+5, 0);
-    mzed_make_table(T6, B, kk*i+6, 0);
-    mzed_make_table(T7, B, kk*i+7, 0);
-    for(babystep = 0; babystep < A->nrows - giantstep; babystep++) {
-      const rci_t j = giantstep + babystep;
-      const rci_t x0 = T0->L[mzed_read_elem(A, j, kk*  i)];
-      const rci_t x1 = T1->L[mzed_read_elem(A, j, kk*i+1)];
-      const rci_t x2 = T2->L[mzed_read_elem(A, j, kk*i+2)];
-      const rci_t x3 = T3->L[mzed_read_elem(A, j, kk*i+3)];
-      const rci_t x4 = T4->L[mzed_read_elem(A, j, kk*i+4)];
-      const rci_t x5 = T5->L[mzed_read_elem(A, j, kk*i+5)];
-      const rci_t x6 = T6->L[mzed_read_elem(A, j, kk*i+6)];
-      const rci_t x7 = T7->L[mzed_read_elem(A, j, kk*i+7)];
-      mzed_combine8(C, j, T0->T, x0, T1->T, x1, T2->T, x2, T3->T, x3, T4->T, x4, T5->T, x5, T6->T, x6, T7->T, x7);
-    }
-  }
-  
-  if (A->ncols%kk) {
     for(rci_t i=kk*end; i < A->ncols; i++) {
-      mzed_make_table(T0, B, i, 0);
+#ifdef HAVE_OPENMP
+#pragma omp single
+#endif
+      mzed_make_table(T[0], B, i, 0);
+
+#ifdef HAVE_OPENMP
+#pragma omp for schedule(static)
+#endif
       for(rci_t j=0; j<A->nrows; j++)
-        mzd_combine(C->x, j, 0, C->x, j, 0, T0->T->x, T0->L[mzed_read_elem(A, j, i)], 0);
+        _mzd_combine_njt(C->x, j, T[0], mzed_read_elem(A, j, i));
     }
   }
+}
+
+rci_t _mzed_mul_newton_john_stripe_ncols(const gf2e *ff) {
+  /** split tables take two of the eight rows of mzed_combine8() **/
+  const rci_t kk = (ff->degree > M4RIE_NJT_SPLIT_DEGREE) ? 4 : 8;
+
+  /**
+   * The stripe width is a multiple of a cache line of words, such that all stripes but the last
+   * start and end on word boundaries and the rows of the windows are aligned as the rows of B and
+   * C.
+   */
+  size_t words = __M4RIE_NJ_MUL_STRIPE_SIZE / ((size_t)kk * njt_mzed_rows(ff) * sizeof(word));
+  words = MAX(__M4RIE_NJ_MUL_STRIPE_MIN_WIDTH, words - words % __M4RIE_CACHE_LINE_WORDS);
+  return (rci_t)(words * (m4ri_radix/gf2e_degree_to_w(ff)));
+}
+
+mzed_t *_mzed_mul_newton_john(mzed_t *C, const mzed_t *A, const mzed_t *B) {
+  if (A->finite_field->degree > A->nrows || A->finite_field->degree > M4RIE_MAX_TABLE_DEGREE)
+    return _mzed_mul_naive(C, A, B);
+
+  const gf2e *ff = A->finite_field;
+
+  /** split tables take two of the eight rows of mzed_combine8() **/
+  const rci_t kk = (ff->degree > M4RIE_NJT_SPLIT_DEGREE) ? 4 : 8;
 
-  njt_mzed_free(T0); njt_mzed_free(T1);  njt_mzed_free(T2); njt_mzed_free(T3);
-  njt_mzed_free(T4); njt_mzed_free(T5);  njt_mzed_free(T6); njt_mzed_free(T7);
+  const rci_t stripe = _mzed_mul_newton_john_stripe_ncols(ff);
+
+  njt_mzed_t *T[8];
+
+  if (stripe >= B->ncols || B->x->offset || C->x->offset) {
+    for(int t=0; t<kk; t++)
+      T[t] = njt_mzed_get(ff, B->ncols);
+    _mzed_mul_newton_john_stripe(C, A, B, T, kk);
+    for(int t=0; t<kk; t++)
+      njt_mzed_release(T[t]);
+    return C;
+  }
+
+  for(rci_t c=0; c<B->ncols; c+=stripe) {
+    const rci_t hc = MIN(c + stripe, B->ncols);
+    mzed_t *Bw = mzed_init_window(B, 0, c, B->nrows, hc);
+    mzed_t *Cw = mzed_init_window(C, 0, c, C->nrows, hc);
+
+    for(int t=0; t<kk; t++)
+      T[t] = njt_mzed_get(ff, hc - c);
+    _mzed_mul_newton_john_stripe(Cw, A, Bw, T, kk);
+    for(int t=0; t<kk; t++)
+      njt_mzed_release(T[t]);
+
+    mzed_free_window(Bw);
+    mzed_free_window(Cw);
+  }
   return C;
 }
 
@@ -532,20 +787,26 @@ void mzed_trsm_lower_left_newton_john(const mzed_t *L, mzed_t *B) {
   assert(B->nrows == L->ncols);
 
   const gf2e *ff = L->finite_field;
-  if (__M4RI_TWOPOW(ff->degree) >= L->nrows) {
+  if (njt_mzed_rows(ff) >= L->nrows) {
     mzed_trsm_lower_left_naive(L, B);
     return;
   }
 
-  njt_mzed_t *T0 = njt_mzed_init(B->finite_field, B->ncols);
+  njt_mzed_t *T0 = njt_mzed_get(B->finite_field, B->ncols);
+
+  word *diag = (word*)m4ri_mm_malloc(B->nrows * sizeof(word));
+  for(rci_t i=0; i<B->nrows; i++)
+    diag[i] = mzed_read_elem(L, i, i);
+  gf2e_inv_batch(ff, diag, diag, B->nrows);
 
   for(rci_t i=0; i<B->nrows; i++) {
-    mzed_rescale_row(B, i, 0, gf2e_inv(ff, mzed_read_elem(L, i, i)));
+    mzed_rescale_row(B, i, 0, diag[i]);
     mzed_make_table(T0, B, i, 0);
     for(rci_t j=i+1; j<B->nrows; j++)
-      mzd_combine(B->x, j, 0, B->x, j, 0, T0->T->x, T0->L[mzed_read_elem(L, j, i)], 0);
+      _mzd_combine_njt(B->x, j, T0, mzed_read_elem(L, j, i));
   }
-  njt_mzed_free(T0);
+  m4ri_mm_free(diag);
+  njt_mzed_release(T0);
 }
 
 void mzed_trsm_upper_left_newton_john(const mzed_t *U, mzed_t *B) {
@@ -554,20 +815,26 @@ void mzed_trsm_upper_left_newton_john(const mzed_t *U, mzed_t *B) {
   assert(B->nrows == U->ncols);
 
   const gf2e *ff = U->finite_field;
-  if ( (__M4RI_TWOPOW(ff->degree) >= U->nrows) || B->x->offset ) {
+  if ( (njt_mzed_rows(ff) >= U->nrows) || B->x->offset ) {
     mzed_trsm_upper_left_naive(U, B);
     return;
   }
 
-  njt_mzed_t *T0 = njt_mzed_init(B->finite_field, B->ncols);
+  njt_mzed_t *T0 = njt_mzed_get(B->finite_field, B->ncols);
+
+  word *diag = (word*)m4ri_mm_malloc(B->nrows * sizeof(word));
+  for(rci_t i=0; i<B->nrows; i++)
+    diag[i] = mzed_read_elem(U, i, i);
+  gf2e_inv_batch(ff, diag, diag, B->nrows);
 
   for(int i=B->nrows-1; i>=0; i--) {
-    mzed_rescale_row(B, i, 0, gf2e_inv(ff, mzed_read_elem(U, i, i)));
+    mzed_rescale_row(B, i, 0, diag[i]);
     mzed_make_table(T0, B, i, 0);
     for(rci_t j=0; j<i; j++)
-      mzd_combine(B->x, j, 0, B->x, j, 0, T0->T->x, T0->L[mzed_read_elem(U, j, i)], 0);
+      _mzd_combine_njt(B->x, j, T0, mzed_read_elem(U, j, i));
   }
-  njt_mzed_free(T0);
+  m4ri_mm_free(diag);
+  njt_mzed_release(T0);
 }
 
 void mzd_slice_trsm_lower_left_newton_john(const mzd_slice_t *L, mzd_slice_t *B) {
@@ -577,23 +844,29 @@ void mzd_slice_trsm_lower_left_newton_john(const mzd_slice_t *L, mzd_slice_t *B)
   assert(B->nrows == L->ncols);
 
   const gf2e *ff = L->finite_field;
-  if (__M4RI_TWOPOW(ff->degree) >= L->nrows) {
+  if (njt_mzed_rows(ff) >= L->nrows) {
     mzd_slice_trsm_lower_left_naive(L, B);
     return;
   }
 
   mzed_t *Be = mzed_cling(NULL, B);
-  njt_mzed_t *T0 = njt_mzed_init(B->finite_field, B->ncols);
+  njt_mzed_t *T0 = njt_mzed_get(B->finite_field, B->ncols);
+
+  word *diag = (word*)m4ri_mm_malloc(B->nrows * sizeof(word));
+  for(rci_t i=0; i<B->nrows; i++)
+    diag[i] = mzd_slice_read_elem(L, i, i);
+  gf2e_inv_batch(ff, diag, diag, B->nrows);
 
   for(rci_t i=0; i<B->nrows; i++) {
-    mzed_rescale_row(Be, i, 0, gf2e_inv(ff, mzd_slice_read_elem(L, i, i)));
+    mzed_rescale_row(Be, i, 0, diag[i]);
     mzed_make_table(T0, Be, i, 0);
     for(rci_t j=i+1; j<Be->nrows; j++)
-      mzd_combine(Be->x, j, 0, Be->x, j, 0, T0->T->x, T0->L[mzd_slice_read_elem(L, j, i)], 0);
+      _mzd_combine_njt(Be->x, j, T0, mzd_slice_read_elem(L, j, i));
   }
+  m4ri_mm_free(diag);
   mzed_slice(B, Be);
   mzed_free(Be);
-  njt_mzed_free(T0);
+  njt_mzed_release(T0);
 }
 
 void mzd_slice_trsm_upper_left_newton_john(const mzd_slice_t *U, mzd_slice_t *B) {
@@ -603,21 +876,27 @@ void mzd_slice_trsm_upper_left_newton_john(const mzd_slice_t *U, mzd_slice_t *B)
   assert(B->nrows == U->ncols);
 
   const gf2e *ff = U->finite_field;
-  if ( (__M4RI_TWOPOW(ff->degree) >= U->nrows)) {
+  if ( (njt_mzed_rows(ff) >= U->nrows)) {
     mzd_slice_trsm_upper_left_naive(U, B);
     return;
   }
 
   mzed_t *Be = mzed_cling(NULL, B);
-  njt_mzed_t *T0 = njt_mzed_init(Be->finite_field, Be->ncols);
+  njt_mzed_t *T0 = njt_mzed_get(Be->finite_field, Be->ncols);
+
+  word *diag = (word*)m4ri_mm_malloc(B->nrows * sizeof(word));
+  for(rci_t i=0; i<B->nrows; i++)
+    diag[i] = mzd_slice_read_elem(U, i, i);
+  gf2e_inv_batch(ff, diag, diag, B->nrows);
 
   for(int i=B->nrows-1; i>=0; i--) {
-    mzed_rescale_row(Be, i, 0, gf2e_inv(ff, mzd_slice_read_elem(U, i, i)));
+    mzed_rescale_row(Be, i, 0, diag[i]);
     mzed_make_table(T0, Be, i, 0);
     for(rci_t j=0; j<i; j++)
-      mzd_combine(Be->x, j, 0, Be->x, j, 0, T0->T->x, T0->L[mzd_slice_read_elem(U, j, i)], 0);
+      _mzd_combine_njt(Be->x, j, T0, mzd_slice_read_elem(U, j, i));
   }
+  m4ri_mm_free(diag);
   mzed_slice(B, Be);
   mzed_free(Be);
-  njt_mzed_free(T0);
+  njt_mzed_release(T0);
 }
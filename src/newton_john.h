@@ -34,20 +34,46 @@
 #include <m4rie/mzed.h>
 #include <m4rie/mzd_slice.h>
 
+/**
+ * Newton-John tables for fields of higher degree are split into a table for the lower
+ * M4RIE_NJT_SPLIT_DEGREE bits of an element and a table for the remaining bits.
+ */
+
+#define M4RIE_NJT_SPLIT_DEGREE 8
+
 /**
  * \brief Newton-John table
+ *
+ * For \e > M4RIE_NJT_SPLIT_DEGREE the table is split: the row for \f$a = a_0 + a_1 \cdot
+ * 2^{8}\f$ with \f$a_0 < 2^8\f$ is the sum of row L[a_0] of T and row L1[a_1] of T1. Hence
+ * \f$2^8 + 2^{e-8}\f$ instead of \f$2^e\f$ rows are computed and stored, e.g. 512 instead of
+ * 65536 for \e = 16.
  */
 
 typedef struct {
   rci_t *L;  /**< A map such that L[a] points to the row where the first entry is a. */
   mzed_t *M; /**< Table of length \e with multiples of the input s.t. \f$a^i\f$ is the first entry of row \f$i\f$. */
-  mzed_t *T; /**< Actual table of length \f$2^e\f$ of all linear combinations of T. */
+  mzed_t *T; /**< Actual table of length \f$2^e\f$ of all linear combinations of T, or of the first 8 rows of M if split. */
+  rci_t *L1;  /**< Map for the upper \e - 8 bits of a if split, NULL otherwise. */
+  mzed_t *T1; /**< All linear combinations of the last \e - 8 rows of M if split, NULL otherwise. */
 } njt_mzed_t;
 
 /**
- * \brief Allocate Newton-John table of dimension gf2e::degree<<1 * ncols.
+ * \brief Return the number of rows of all Newton-John tables for ff.
  *
- * \param ff Finite field.
+ * \param ff Finite field with degree <= M4RIE_MAX_TABLE_DEGREE.
+ */
+
+static inline rci_t njt_mzed_rows(const gf2e *ff) {
+  if (ff->degree > M4RIE_NJT_SPLIT_DEGREE)
+    return __M4RI_TWOPOW(M4RIE_NJT_SPLIT_DEGREE) + __M4RI_TWOPOW(ff->degree - M4RIE_NJT_SPLIT_DEGREE);
+  return __M4RI_TWOPOW(ff->degree);
+}
+
+/**
+ * \brief Allocate Newton-John table of dimension njt_mzed_rows() * ncols.
+ *
+ * \param ff Finite field with degree <= M4RIE_MAX_TABLE_DEGREE.
  * \param ncols Integer > 0.
  */
 
@@ -61,6 +87,41 @@ njt_mzed_t *njt_mzed_init(const gf2e *ff, const rci_t ncols);
 
 void njt_mzed_free(njt_mzed_t *t);
 
+/**
+ * Bytes of idle tables kept by njt_mzed_release().
+ */
+
+#define M4RIE_NJT_CACHE_SIZE (1<<25)
+
+/**
+ * \brief Return a Newton-John table for ff and ncols columns, reusing a released one if possible.
+ *
+ * The table is for the exclusive use of the caller until it is returned with njt_mzed_release().
+ * Its contents are undefined until it is filled with mzed_make_table().
+ *
+ * \param ff Finite field with degree <= M4RIE_MAX_TABLE_DEGREE.
+ * \param ncols Integer > 0.
+ */
+
+njt_mzed_t *njt_mzed_get(const gf2e *ff, const rci_t ncols);
+
+/**
+ * \brief Return a table obtained from njt_mzed_get() or njt_mzed_init().
+ *
+ * The most recently released tables up to M4RIE_NJT_CACHE_SIZE bytes are kept for later calls to
+ * njt_mzed_get(), older ones are freed.
+ *
+ * \param T Table
+ */
+
+void njt_mzed_release(njt_mzed_t *T);
+
+/**
+ * \brief Free all tables kept by njt_mzed_release().
+ */
+
+void njt_mzed_clear(void);
+
 /**
  * \brief Construct Newton-John table T for row r of A, and element A[r,c].
  *
@@ -117,10 +178,41 @@ mzed_t *mzed_addmul_newton_john(mzed_t *C, const mzed_t *A, const mzed_t *B);
 
 mzed_t *_mzed_mul_newton_john0(mzed_t *C, const mzed_t *A, const mzed_t *B);
 
+/**
+ * _mzed_mul_newton_john() uses several threads if it touches more than this many words of C.
+ */
+
+#define __M4RIE_NJ_MUL_PARALLEL_CUTOFF (1<<16)
+
+/**
+ * _mzed_mul_newton_john() processes B in stripes of columns such that the tables of one stripe
+ * take at most this many bytes.
+ */
+
+#define __M4RIE_NJ_MUL_STRIPE_SIZE __M4RI_CPU_L2_CACHE
+
+/**
+ * Stripes are at least this many words wide, such that reading the elements of A and looking up
+ * the table rows is amortised over the rows of C.
+ */
+
+#define __M4RIE_NJ_MUL_STRIPE_MIN_WIDTH 64
+
+/**
+ * \brief Return the number of columns of the stripes of B used by _mzed_mul_newton_john().
+ *
+ * \param ff Finite field.
+ */
+
+rci_t _mzed_mul_newton_john_stripe_ncols(const gf2e *ff);
+
 /**
  * \brief \f$C = C + A \cdot B\f$ using Newton-John tables.
  *
- * This is an optimised implementation.
+ * This is an optimised implementation. If the tables for all columns of B do not fit into
+ * __M4RIE_NJ_MUL_STRIPE_SIZE bytes, B and C are split into stripes of columns and all rows of A
+ * are processed for every stripe, such that the tables stay in cache. With OpenMP the rows of C
+ * are distributed over all threads, which share the tables.
  *
  * \param C Preallocated product matrix.
  * \param A Input matrix A.
@@ -208,6 +300,22 @@ void mzd_slice_trsm_upper_left_newton_john(const mzd_slice_t *U, mzd_slice_t *B)
 
 rci_t mzed_ple_newton_john(mzed_t *A, mzp_t *P, mzp_t *Q);
 
+/**
+ * \brief Same as mzed_process_rows, ..., mzed_process_rows6 for k split tables.
+ *
+ * Up to three tables, i.e. six halves, are applied in one pass over the rows.
+ *
+ * \param M Matrix to operate on
+ * \param startrow top row which is operated on
+ * \param endrow bottom row which is operated on
+ * \param startcol Starting column for addition
+ * \param T k split Newton-John tables
+ * \param k Number of tables
+ */
+
+void _mzed_process_rows_split(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol,
+                              const njt_mzed_t *const *T, const int k);
+
 /**
  * \brief The function looks up 6 entries from position i,startcol in
  * each row and adds the appropriate row from T to the row i.
@@ -225,6 +333,10 @@ rci_t mzed_ple_newton_john(mzed_t *A, mzp_t *P, mzp_t *Q);
  */
 
 static inline void mzed_process_rows(mzed_t *M, const rci_t startrow, const rci_t endrow, rci_t startcol, const njt_mzed_t *T) {
+  if (T->T1) {
+    _mzed_process_rows_split(M, startrow, endrow, startcol, &T, 1);
+    return;
+  }
   mzd_process_rows(M->x, startrow, endrow, startcol*M->w, M->w, T->T->x, T->L);
 }
 
@@ -244,6 +356,11 @@ static inline void mzed_process_rows(mzed_t *M, const rci_t startrow, const rci_
 
 static inline void mzed_process_rows2(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol, 
                                       const njt_mzed_t *T0, const njt_mzed_t *T1) {
+  if (T0->T1) {
+    const njt_mzed_t *T[2] = {T0, T1};
+    _mzed_process_rows_split(M, startrow, endrow, startcol, T, 2);
+    return;
+  }
   mzd_process_rows2(M->x, startrow, endrow, startcol*M->w, 2*M->w, T0->T->x, T0->L, T1->T->x, T1->L);
 }
 
@@ -264,6 +381,11 @@ static inline void mzed_process_rows2(mzed_t *M, const rci_t startrow, const rci
 
 static inline void mzed_process_rows3(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol,
                                       const njt_mzed_t *T0, const njt_mzed_t *T1, const njt_mzed_t *T2) {
+  if (T0->T1) {
+    const njt_mzed_t *T[3] = {T0, T1, T2};
+    _mzed_process_rows_split(M, startrow, endrow, startcol, T, 3);
+    return;
+  }
   mzd_process_rows3(M->x, startrow, endrow, startcol*M->w, 3*M->w, T0->T->x, T0->L, T1->T->x, T1->L, T2->T->x, T2->L);
 }
 
@@ -285,6 +407,11 @@ static inline void mzed_process_rows3(mzed_t *M, const rci_t startrow, const rci
 
 static inline void mzed_process_rows4(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol,
                                       const njt_mzed_t *T0, const njt_mzed_t *T1, const njt_mzed_t *T2, const njt_mzed_t *T3) {
+  if (T0->T1) {
+    const njt_mzed_t *T[4] = {T0, T1, T2, T3};
+    _mzed_process_rows_split(M, startrow, endrow, startcol, T, 4);
+    return;
+  }
   mzd_process_rows4(M->x, startrow, endrow, startcol*M->w, 4*M->w, T0->T->x, T0->L, T1->T->x, T1->L, T2->T->x, T2->L, T3->T->x, T3->L);
 }
 
@@ -307,6 +434,11 @@ static inline void mzed_process_rows4(mzed_t *M, const rci_t startrow, const rci
 
 static inline void mzed_process_rows5(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol,
                                       const njt_mzed_t *T0, const njt_mzed_t *T1, const njt_mzed_t *T2, const njt_mzed_t *T3, const njt_mzed_t *T4) {
+  if (T0->T1) {
+    const njt_mzed_t *T[5] = {T0, T1, T2, T3, T4};
+    _mzed_process_rows_split(M, startrow, endrow, startcol, T, 5);
+    return;
+  }
   mzd_process_rows5(M->x, startrow, endrow, startcol*M->w, 5*M->w, T0->T->x, T0->L, T1->T->x, T1->L, T2->T->x, T2->L, T3->T->x, T3->L, T4->T->x, T4->L);
 }
 
@@ -332,8 +464,45 @@ static inline void mzed_process_rows5(mzed_t *M, const rci_t startrow, const rci
 static inline void mzed_process_rows6(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol,
                                       const njt_mzed_t *T0, const njt_mzed_t *T1, const njt_mzed_t *T2,
                                       const njt_mzed_t *T3, const njt_mzed_t *T4, const njt_mzed_t *T5) {
+  if (T0->T1) {
+    const njt_mzed_t *T[6] = {T0, T1, T2, T3, T4, T5};
+    _mzed_process_rows_split(M, startrow, endrow, startcol, T, 6);
+    return;
+  }
   mzd_process_rows6(M->x, startrow, endrow, startcol*M->w, 6*M->w, T0->T->x, T0->L, T1->T->x, T1->L, T2->T->x, T2->L, T3->T->x, T3->L, T4->T->x, T4->L, T5->T->x, T5->L);
 }
 
+/**
+ * mzed_process_rows_mp() splits the rows into blocks of this many rows.
+ */
+
+#define __M4RIE_PROCESS_ROWS_BLOCK 32
+
+/**
+ * mzed_process_rows_mp() uses several threads if it touches more than this many words.
+ */
+
+#define __M4RIE_PROCESS_ROWS_PARALLEL_CUTOFF (1<<13)
+
+/**
+ * \brief Same as mzed_process_rows, ..., mzed_process_rows6 for k = 1, ..., 6 tables but the rows
+ * are distributed over all threads.
+ *
+ * The tables are only read, hence they are shared by all threads. Without OpenMP or for few rows
+ * this is the same as calling mzed_process_rows, ..., mzed_process_rows6.
+ *
+ * \param M Matrix to operate on
+ * \param startrow top row which is operated on
+ * \param endrow bottom row which is operated on
+ * \param startcol Starting column for addition
+ * \param T k Newton-John tables
+ * \param k Number of tables, 1 <= k <= 6
+ *
+ * \ingroup RowOperations
+ */
+
+void mzed_process_rows_mp(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol,
+                          const njt_mzed_t *const *T, const int k);
+
 
 #endif //M4RIE_NEWTON_JOHN_H
@@ -0,0 +1,81 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <stdlib.h>
+#include "config.h"
+#include "random.h"
+
+static inline word _rotl(const word x, const int k) {
+  return (x << k) | (x >> (64 - k));
+}
+
+/**
+ * The state is filled from SplitMix64 as recommended by the authors of xoshiro256**.
+ */
+
+void m4rie_prng_seed(m4rie_prng_t *R, word seed) {
+  for(int i=0; i<4; i++) {
+    word z = (seed += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    R->s[i] = z ^ (z >> 31);
+  }
+}
+
+word m4rie_prng_next(void *R) {
+  word *s = ((m4rie_prng_t*)R)->s;
+  const word result = _rotl(s[1] * 5, 7) * 9;
+  const word t = s[1] << 17;
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = _rotl(s[3], 45);
+  return result;
+}
+
+word m4rie_random_libc(void *state) {
+  /** random() returns 31 bits **/
+  return ((word)random() << 62) ^ ((word)random() << 31) ^ (word)random();
+}
+
+void _mzd_randomize_masked(mzd_t *A, const word mask, m4rie_random_t rng, void *state) {
+  if (rng == NULL)
+    rng = m4rie_random_libc;
+  if (A->ncols == 0)
+    return;
+
+  const word mask_begin = __M4RI_RIGHT_BITMASK(m4ri_radix - A->offset);
+  const word mask_end = __M4RI_LEFT_BITMASK((A->offset + A->ncols) % m4ri_radix);
+  const wi_t width = A->width;
+
+  for(rci_t i=0; i<A->nrows; i++) {
+    word *row = A->rows[i];
+    if (width == 1) {
+      const word m = mask & mask_begin & mask_end;
+      row[0] = (row[0] & ~(mask_begin & mask_end)) | (rng(state) & m);
+      continue;
+    }
+    row[0] = (row[0] & ~mask_begin) | (rng(state) & mask & mask_begin);
+    for(wi_t j=1; j<width-1; j++)
+      row[j] = rng(state) & mask;
+    row[width-1] = (row[width-1] & ~mask_end) | (rng(state) & mask & mask_end);
+  }
+}
@@ -0,0 +1,94 @@
+/**
+ * \file random.h
+ *
+ * \brief Random number generators for filling matrices.
+ *
+ * Matrices are filled one word at a time from a callback returning 64 random bits. The library
+ * ships m4rie_random_libc() which uses random() and is what mzed_randomize() and
+ * mzd_slice_randomize() use, and the seedable xoshiro256** generator m4rie_prng_t which is
+ * considerably faster and independent of the state of random().
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+#ifndef M4RIE_RANDOM_H
+#define M4RIE_RANDOM_H
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <m4ri/m4ri.h>
+
+/**
+ * \brief Random number generator returning 64 random bits.
+ *
+ * \param state State of the generator as passed by the caller.
+ *
+ * \ingroup Definitions
+ */
+
+typedef word (*m4rie_random_t)(void *state);
+
+/**
+ * \brief State of the xoshiro256** generator, see m4rie_prng_seed().
+ *
+ * \ingroup Definitions
+ */
+
+typedef struct {
+  word s[4]; /**< never all zero */
+} m4rie_prng_t;
+
+/**
+ * \brief Seed R, equal seeds give equal sequences.
+ *
+ * \param R Generator state.
+ * \param seed Any value.
+ */
+
+void m4rie_prng_seed(m4rie_prng_t *R, const word seed);
+
+/**
+ * \brief Return the next 64 bits of the m4rie_prng_t pointed to by R.
+ *
+ * \param R Generator state, m4rie_prng_t.
+ */
+
+word m4rie_prng_next(void *R);
+
+/**
+ * \brief Return 64 bits obtained from random(), the state is ignored.
+ *
+ * \param state Ignored.
+ */
+
+word m4rie_random_libc(void *state);
+
+/**
+ * \brief Fill A with random words anded with mask, bits outside of A are left untouched.
+ *
+ * \param A Matrix.
+ * \param mask Mask applied to every word.
+ * \param rng Random number generator, if NULL m4rie_random_libc() is used.
+ * \param state State passed to rng.
+ */
+
+void _mzd_randomize_masked(mzd_t *A, const word mask, m4rie_random_t rng, void *state);
+
+#endif //M4RIE_RANDOM_H
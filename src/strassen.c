@@ -45,7 +45,7 @@ mzed_t *_mzed_mul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int cuto
   assert(A->x->offset == 0);
   assert(B->x->offset == 0);
 
-  if((C->nrows| C->ncols) == 0)
+  if(C->nrows == 0 || C->ncols == 0)
     return C;
 
   rci_t m = A->nrows;
@@ -193,7 +193,7 @@ mzed_t *_mzed_addmul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int c
   assert(A->x->offset == 0);
   assert(B->x->offset == 0);
 
-  if((C->nrows| C->ncols) == 0)
+  if(C->nrows == 0 || C->ncols == 0)
     return C;
 
   rci_t m = A->nrows;
@@ -372,7 +372,7 @@ rci_t _mzed_strassen_cutoff(const mzed_t *C, const mzed_t *A, const mzed_t *B) {
     break;
   }
 
-  if (cutoff < 2*__M4RI_TWOPOW(A->finite_field->degree))
-    cutoff = 2*__M4RI_TWOPOW(A->finite_field->degree);
+  if (A->finite_field->degree <= M4RIE_MAX_TABLE_DEGREE && cutoff < 2*njt_mzed_rows(A->finite_field))
+    cutoff = 2*njt_mzed_rows(A->finite_field);
   return cutoff;
 }
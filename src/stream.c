@@ -0,0 +1,211 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <string.h>
+#include "config.h"
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+#include "stream.h"
+#include "mzd_slice.h"
+#include "conversion.h"
+#include "io.h"
+
+/**
+ * Multiply the first k rows of A by B into C and write them.
+ */
+
+static int _mzed_mul_stream_block(mzed_t *C, mzed_t *A, const mzed_t *B, const mzd_slice_t *Bs, const rci_t k,
+                                  const rci_t row, mzed_write_rows_t write, void *write_state) {
+  mzed_t *Aw = A, *Cw = C;
+  if (k < A->nrows) {
+    Aw = mzed_init_window(A, 0, 0, k, A->ncols);
+    Cw = mzed_init_window(C, 0, 0, k, C->ncols);
+  }
+
+  if (Bs) {
+    mzd_slice_t *As = mzed_slice(NULL, Aw);
+    mzd_slice_t *Cs = mzd_slice_mul(NULL, As, Bs);
+    mzed_cling(Cw, Cs);
+    mzd_slice_free(As);
+    mzd_slice_free(Cs);
+  } else {
+    mzed_mul(Cw, Aw, B);
+  }
+  const int ret = write(Cw, row, write_state);
+
+  if (k < A->nrows) {
+    mzed_free_window(Aw);
+    mzed_free_window(Cw);
+  }
+  return ret;
+}
+
+/**
+ * A call to read, run in its own thread while the previous block is multiplied.
+ */
+
+typedef struct {
+  mzed_read_rows_t read;
+  void *state;
+  mzed_t *A;
+  rci_t row;
+  rci_t k;   /**< return value of read */
+} _mzed_stream_read_t;
+
+static void *_mzed_stream_read(void *arg) {
+  _mzed_stream_read_t *r = (_mzed_stream_read_t*)arg;
+  r->k = r->read(r->A, r->row, r->state);
+  return NULL;
+}
+
+rci_t mzed_mul_stream(const mzed_t *B, rci_t block_rows,
+                      mzed_read_rows_t read, void *read_state,
+                      mzed_write_rows_t write, void *write_state) {
+  const gf2e *ff = B->finite_field;
+  if (block_rows <= 0)
+    block_rows = MAX(64, __M4RIE_STREAM_BLOCK_SIZE/((size_t)B->w*B->nrows/8 + 1));
+
+  mzed_t *A[2] = {mzed_init(ff, block_rows, B->nrows), mzed_init(ff, block_rows, B->nrows)};
+  mzed_t *C = mzed_init(ff, block_rows, B->ncols);
+  mzd_slice_t *Bs = _mzed_mul_use_karatsuba(ff, block_rows, B->nrows, B->ncols) ? mzed_slice(NULL, B) : NULL;
+
+  rci_t row = 0;
+  rci_t k = read(A[0], 0, read_state);
+  int cur = 0;
+
+  while (k > 0) {
+    /** A[cur^1] is not in use, hence the next block can be read meanwhile **/
+    _mzed_stream_read_t r = {read, read_state, A[cur^1], row + k, 0};
+    const int reading = (k == block_rows);
+    int threaded = 0;
+#ifdef HAVE_PTHREAD_H
+    pthread_t thread;
+    if (reading)
+      threaded = (pthread_create(&thread, NULL, _mzed_stream_read, &r) == 0);
+#endif
+
+    const int ret = _mzed_mul_stream_block(C, A[cur], B, Bs, k, row, write, write_state);
+
+#ifdef HAVE_PTHREAD_H
+    if (threaded)
+      pthread_join(thread, NULL);
+#endif
+    if (reading && !threaded && ret == 0)
+      _mzed_stream_read(&r);
+
+    if (ret != 0) {
+      k = -1;
+      break;
+    }
+    row += k;
+    k = r.k;
+    cur ^= 1;
+  }
+
+  if (Bs)
+    mzd_slice_free(Bs);
+  mzed_free(A[0]);
+  mzed_free(A[1]);
+  mzed_free(C);
+  return (k < 0) ? -1 : row;
+}
+
+static int _mzed_write_rows_file(const mzed_t *C, const rci_t row, void *state) {
+  return _mzed_file_append((FILE*)state, C);
+}
+
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_M4RI_EXTERNAL_ROWS)
+
+/**
+ * mzed_map_file() does not copy A, hence copying the rows of the mapping is where the pages of A
+ * are read.
+ */
+
+static rci_t _mzed_read_rows_mapped(mzed_t *A, const rci_t row, void *state) {
+  const mzed_t *M = (const mzed_t*)state;
+  const rci_t k = MIN(A->nrows, M->nrows - row);
+  for(rci_t i=0; i<k; i++)
+    memcpy(A->x->rows[i], M->x->rows[row + i], A->x->width * sizeof(word));
+  return k;
+}
+
+int mzed_mul_file(const char *C_filename, const char *A_filename, const mzed_t *B, const rci_t block_rows) {
+  mzed_t *A = mzed_map_file(B->finite_field, A_filename);
+  if (A == NULL)
+    return -1;
+  if (A->ncols != B->nrows) {
+    mzed_unmap_file(A);
+    return -1;
+  }
+
+  FILE *fh = _mzed_file_create(C_filename, B->finite_field, A->nrows, B->ncols);
+  if (fh == NULL) {
+    mzed_unmap_file(A);
+    return -1;
+  }
+
+  int ret = (mzed_mul_stream(B, block_rows, _mzed_read_rows_mapped, A, _mzed_write_rows_file, fh) == A->nrows) ? 0 : -1;
+  if (fclose(fh) != 0)
+    ret = -1;
+  mzed_unmap_file(A);
+  return ret;
+}
+
+#else
+
+/**
+ * Without zero-copy mappings each block of A is read from the file.
+ */
+
+typedef struct {
+  FILE *fh;
+  rci_t nrows;
+} _mzed_file_rows_t;
+
+static rci_t _mzed_read_rows_file(mzed_t *A, const rci_t row, void *state) {
+  const _mzed_file_rows_t *f = (const _mzed_file_rows_t*)state;
+  return _mzed_file_read(f->fh, A, f->nrows, row);
+}
+
+int mzed_mul_file(const char *C_filename, const char *A_filename, const mzed_t *B, const rci_t block_rows) {
+  _mzed_file_rows_t A;
+  rci_t n;
+  A.fh = _mzed_file_open(A_filename, B->finite_field, &A.nrows, &n);
+  if (A.fh == NULL)
+    return -1;
+  if (n != B->nrows) {
+    fclose(A.fh);
+    return -1;
+  }
+
+  FILE *fh = _mzed_file_create(C_filename, B->finite_field, A.nrows, B->ncols);
+  if (fh == NULL) {
+    fclose(A.fh);
+    return -1;
+  }
+
+  int ret = (mzed_mul_stream(B, block_rows, _mzed_read_rows_file, &A, _mzed_write_rows_file, fh) == A.nrows) ? 0 : -1;
+  if (fclose(fh) != 0)
+    ret = -1;
+  fclose(A.fh);
+  return ret;
+}
+
+#endif
@@ -0,0 +1,119 @@
+/**
+ * \file stream.h
+ *
+ * \brief Multiplication of matrices A which do not fit into memory by a resident matrix B.
+ *
+ * A is read in blocks of rows through a callback, every block is multiplied by B and the block of
+ * C = A*B is handed to a second callback. If POSIX threads are available the next block of A is
+ * read in a separate thread while the current one is multiplied and written by the calling thread,
+ * hence the multiplication uses all OpenMP threads. If the blocks are large enough for Karatsuba
+ * multiplication B is bitsliced once up front rather than for every block.
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+#ifndef M4RIE_STREAM_H
+#define M4RIE_STREAM_H
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <m4ri/m4ri.h>
+#include <m4rie/gf2e.h>
+#include <m4rie/mzed.h>
+
+/**
+ * \brief Fill the rows of A with the rows row, row+1, ... of the operand.
+ *
+ * \param A Block of rows.
+ * \param row Index of the first row to read.
+ * \param state State passed to mzed_mul_stream().
+ *
+ * \return The number of rows read, less than A->nrows only at the end, or -1 on error.
+ *
+ * \ingroup Definitions
+ */
+
+typedef rci_t (*mzed_read_rows_t)(mzed_t *A, const rci_t row, void *state);
+
+/**
+ * \brief Consume the rows row, row+1, ... of the product.
+ *
+ * \param C Block of rows, only valid during the call.
+ * \param row Index of the first row of C in the product.
+ * \param state State passed to mzed_mul_stream().
+ *
+ * \return 0 on success and -1 on error.
+ *
+ * \ingroup Definitions
+ */
+
+typedef int (*mzed_write_rows_t)(const mzed_t *C, const rci_t row, void *state);
+
+/**
+ * If no number of rows is given mzed_mul_stream() reads blocks of A of about this many bytes.
+ */
+
+#define __M4RIE_STREAM_BLOCK_SIZE (1<<26)
+
+/**
+ * \brief C = A*B where A is read and C is written in blocks of rows.
+ *
+ * Blocks are read and written in order. If POSIX threads are available read is called in a
+ * separate thread while the previous block is multiplied and written, i.e. read and write may run
+ * concurrently in different threads.
+ *
+ * \param B Matrix.
+ * \param block_rows Number of rows per block or 0 for a default.
+ * \param read Returns blocks of A, which has B->nrows columns.
+ * \param read_state Passed to read.
+ * \param write Receives blocks of C.
+ * \param write_state Passed to write.
+ *
+ * \return The number of rows of C written or -1 if read or write failed.
+ *
+ * \ingroup Multiplication
+ */
+
+rci_t mzed_mul_stream(const mzed_t *B, rci_t block_rows,
+                      mzed_read_rows_t read, void *read_state,
+                      mzed_write_rows_t write, void *write_state);
+
+/**
+ * \brief Write A*B to C_filename where A is read from A_filename.
+ *
+ * Both files are in the binary format of mzed_write_file(). Only two blocks of rows of A and one
+ * of C are held in memory at any time. If mzed_map_file() maps the rows of A without copying them
+ * the blocks are copied from the mapping, whose pages are not written to and may be evicted.
+ * Otherwise each block is read from A_filename directly.
+ *
+ * \param C_filename Output file.
+ * \param A_filename Input file with a matrix over B->finite_field with B->nrows columns.
+ * \param B Matrix.
+ * \param block_rows Number of rows per block or 0 for a default.
+ *
+ * \return 0 on success and -1 if A_filename cannot be read or does not match B or if C_filename
+ * cannot be written.
+ *
+ * \ingroup Multiplication
+ */
+
+int mzed_mul_file(const char *C_filename, const char *A_filename, const mzed_t *B, const rci_t block_rows);
+
+#endif //M4RIE_STREAM_H
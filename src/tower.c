@@ -0,0 +1,268 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include "config.h"
+#include "tower.h"
+#include "conversion.h"
+
+/**
+ * Absolute trace of a in GF(2^8), Y^2 + Y + c is irreducible iff the trace of c is one.
+ */
+
+static word _gf2e_trace(const gf2e *ff, word a) {
+  word t = a;
+  for(unsigned int i=1; i<ff->degree; i++) {
+    a = gf2e_mul(ff, a, a);
+    t ^= a;
+  }
+  return t;
+}
+
+gf2e_tower_t *gf2e_tower_init(const gf2e *ff) {
+  if (ff->degree != 16)
+    m4ri_die("tower representation is only supported for degree 16.\n");
+
+  gf2e_tower_t *T = (gf2e_tower_t*)m4ri_mm_calloc(1, sizeof(gf2e_tower_t));
+  T->ff = ff;
+  T->base = gf2e_get(irreducible_polynomials[8][1]);
+
+  for(T->c=1; T->c<256; T->c++)
+    if (_gf2e_trace(T->base, T->c) == 1)
+      break;
+
+  /** find a root z of minpoly outside of the base field using Horner's rule **/
+  word z;
+  for(z=256; z<__M4RI_TWOPOW(16); z++) {
+    word r = 0;
+    for(int i=ff->degree; i>=0; i--) {
+      r = gf2e_tower_mul(T, r, z);
+      if (ff->minpoly & __M4RI_TWOPOW(i))
+        r ^= 1;
+    }
+    if (r == 0)
+      break;
+  }
+  if (z == __M4RI_TWOPOW(16))
+    m4ri_die("minimal polynomial has no root in the tower.\n");
+
+  /** X^i -> z^i **/
+  word img[16];
+  img[0] = 1;
+  for(int i=1; i<16; i++)
+    img[i] = gf2e_tower_mul(T, img[i-1], z);
+
+  /** preimages of the unit vectors, the map is a bijection **/
+  word pre[16];
+  for(word a=1; a<__M4RI_TWOPOW(16); a++) {
+    word v = 0;
+    for(int i=0; i<16; i++)
+      if (a & __M4RI_TWOPOW(i))
+        v ^= img[i];
+    if ((v & (v-1)) == 0)
+      pre[gf2x_deg(v)] = a;
+  }
+
+  for(word b=0; b<256; b++) {
+    for(int k=0; k<2; k++) {
+      T->to[k][b] = 0;
+      T->from[k][b] = 0;
+      for(int i=0; i<8; i++) {
+        if (b & __M4RI_TWOPOW(i)) {
+          T->to[k][b] ^= img[8*k+i];
+          T->from[k][b] ^= pre[8*k+i];
+        }
+      }
+    }
+  }
+  return T;
+}
+
+void gf2e_tower_free(gf2e_tower_t *T) {
+  gf2e_release(T->base);
+  m4ri_mm_free(T);
+}
+
+mzed_tower_t *mzed_tower_init(const gf2e_tower_t *T, const rci_t m, const rci_t n) {
+  mzed_tower_t *A = (mzed_tower_t*)m4ri_mm_malloc(sizeof(mzed_tower_t));
+  A->x[0] = mzed_init(T->base, m, n);
+  A->x[1] = mzed_init(T->base, m, n);
+  A->nrows = m;
+  A->ncols = n;
+  A->tower = T;
+  return A;
+}
+
+void mzed_tower_free(mzed_tower_t *A) {
+  mzed_free(A->x[0]);
+  mzed_free(A->x[1]);
+  m4ri_mm_free(A);
+}
+
+mzed_tower_t *mzed_to_tower(mzed_tower_t *B, const mzed_t *A, const gf2e_tower_t *T) {
+  assert(A->finite_field == T->ff && A->x->offset == 0);
+  if (B == NULL)
+    B = mzed_tower_init(T, A->nrows, A->ncols);
+  assert(B->tower == T && B->nrows == A->nrows && B->ncols == A->ncols);
+
+  /** two words of 16-bit elements give one word of bytes in each coefficient **/
+  const wi_t width = A->x->width;
+  for(rci_t i=0; i<A->nrows; i++) {
+    const word *a = A->x->rows[i];
+    word *b0 = B->x[0]->x->rows[i];
+    word *b1 = B->x[1]->x->rows[i];
+    for(wi_t j=0; j<B->x[0]->x->width; j++) {
+      word lo = 0, hi = 0;
+      for(int h=0; h<2 && 2*j+h < width; h++) {
+        const word v = a[2*j+h];
+        for(int k=0; k<4; k++) {
+          const word t = gf2e_tower_to(T, (v >> (16*k)) & 0xffff);
+          lo |= (t & 0xff) << (8*(4*h+k));
+          hi |= (t >> 8)   << (8*(4*h+k));
+        }
+      }
+      b0[j] = lo;
+      b1[j] = hi;
+    }
+  }
+  return B;
+}
+
+mzed_t *mzed_from_tower(mzed_t *A, const mzed_tower_t *B) {
+  const gf2e_tower_t *T = B->tower;
+  if (A == NULL)
+    A = mzed_init(T->ff, B->nrows, B->ncols);
+  assert(A->finite_field == T->ff && A->x->offset == 0);
+  assert(A->nrows == B->nrows && A->ncols == B->ncols);
+
+  const wi_t width = A->x->width;
+  for(rci_t i=0; i<A->nrows; i++) {
+    word *a = A->x->rows[i];
+    const word *b0 = B->x[0]->x->rows[i];
+    const word *b1 = B->x[1]->x->rows[i];
+    for(wi_t j=0; j<width; j++) {
+      const word lo = b0[j/2] >> (32*(j%2));
+      const word hi = b1[j/2] >> (32*(j%2));
+      word v = 0;
+      for(int k=0; k<4; k++) {
+        const word t = ((hi >> (8*k)) & 0xff) << 8 | ((lo >> (8*k)) & 0xff);
+        v |= gf2e_tower_from(T, t) << (16*k);
+      }
+      a[j] = v;
+    }
+  }
+  return A;
+}
+
+mzed_tower_t *mzd_slice_to_tower(mzed_tower_t *B, const mzd_slice_t *A, const gf2e_tower_t *T) {
+  assert(A->finite_field == T->ff);
+  if (B == NULL)
+    B = mzed_tower_init(T, A->nrows, A->ncols);
+
+  /** bit j of coefficient k is the sum of the slices i whose image has bit 8k+j set **/
+  for(int k=0; k<2; k++) {
+    mzd_slice_t *S = mzd_slice_init(T->base, A->nrows, A->ncols);
+    for(int i=0; i<16; i++) {
+      const word img = T->to[i/8][__M4RI_TWOPOW(i%8)] >> (8*k);
+      for(int j=0; j<8; j++)
+        if (img & __M4RI_TWOPOW(j))
+          mzd_add(S->x[j], S->x[j], A->x[i]);
+    }
+    mzed_cling(B->x[k], S);
+    mzd_slice_free(S);
+  }
+  return B;
+}
+
+mzd_slice_t *mzd_slice_from_tower(mzd_slice_t *A, const mzed_tower_t *B) {
+  const gf2e_tower_t *T = B->tower;
+  if (A == NULL)
+    A = mzd_slice_init(T->ff, B->nrows, B->ncols);
+  else
+    mzd_slice_set_ui(A, 0);
+
+  for(int k=0; k<2; k++) {
+    mzd_slice_t *S = mzed_slice(NULL, B->x[k]);
+    for(int j=0; j<8; j++) {
+      const word pre = T->from[k][__M4RI_TWOPOW(j)];
+      for(int i=0; i<16; i++)
+        if (pre & __M4RI_TWOPOW(i))
+          mzd_add(A->x[i], A->x[i], S->x[j]);
+    }
+    mzd_slice_free(S);
+  }
+  return A;
+}
+
+/**
+ * C1 += (A0 + A1)*(B0 + B1) + A0*B0 and C0 += A0*B0 + c*A1*B1.
+ */
+
+static mzed_tower_t *_mzed_tower_addmul(mzed_tower_t *C, const mzed_tower_t *A, const mzed_tower_t *B) {
+  const gf2e_tower_t *T = A->tower;
+
+  mzed_t *P = mzed_mul(NULL, A->x[0], B->x[0]);
+  mzed_add(C->x[0], C->x[0], P);
+  mzed_add(C->x[1], C->x[1], P);
+
+  mzed_mul(P, A->x[1], B->x[1]);
+  mzed_mul_scalar(P, T->c, P);
+  mzed_add(C->x[0], C->x[0], P);
+  mzed_free(P);
+
+  mzed_t *SA = mzed_add(NULL, A->x[0], A->x[1]);
+  mzed_t *SB = mzed_add(NULL, B->x[0], B->x[1]);
+  mzed_addmul(C->x[1], SA, SB);
+  mzed_free(SA);
+  mzed_free(SB);
+  return C;
+}
+
+mzed_tower_t *mzed_tower_mul(mzed_tower_t *C, const mzed_tower_t *A, const mzed_tower_t *B) {
+  if (A->ncols != B->nrows || A->tower != B->tower)
+    m4ri_die("mzed_tower_mul: rows, columns and towers must match.\n");
+  if (C == NULL) {
+    C = mzed_tower_init(A->tower, A->nrows, B->ncols);
+  } else {
+    if (C->tower != A->tower || C->nrows != A->nrows || C->ncols != B->ncols)
+      m4ri_die("mzed_tower_mul: rows and columns of returned matrix must match.\n");
+    mzed_set_ui(C->x[0], 0);
+    mzed_set_ui(C->x[1], 0);
+  }
+  return _mzed_tower_addmul(C, A, B);
+}
+
+mzed_tower_t *mzed_tower_addmul(mzed_tower_t *C, const mzed_tower_t *A, const mzed_tower_t *B) {
+  if (A->ncols != B->nrows || A->tower != B->tower)
+    m4ri_die("mzed_tower_addmul: rows, columns and towers must match.\n");
+  if (C->tower != A->tower || C->nrows != A->nrows || C->ncols != B->ncols)
+    m4ri_die("mzed_tower_addmul: rows and columns of returned matrix must match.\n");
+  return _mzed_tower_addmul(C, A, B);
+}
+
+mzed_t *mzed_mul_tower(mzed_t *C, const mzed_t *A, const mzed_t *B, const gf2e_tower_t *T) {
+  C = _mzed_mul_init(C, A, B, TRUE);
+  mzed_tower_t *At = mzed_to_tower(NULL, A, T);
+  mzed_tower_t *Bt = mzed_to_tower(NULL, B, T);
+  mzed_tower_t *Ct = mzed_tower_mul(NULL, At, Bt);
+  mzed_from_tower(C, Ct);
+  mzed_tower_free(At);
+  mzed_tower_free(Bt);
+  mzed_tower_free(Ct);
+  return C;
+}
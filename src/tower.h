@@ -0,0 +1,234 @@
+/**
+ * \file tower.h
+ *
+ * \brief \GF2E for e=16 as the quadratic extension \f$\mathbb{F}_{2^8}[Y]/(Y^2+Y+c)\f$.
+ *
+ * Elements of the tower are stored as a1*Y + a0 with a0,a1 in \f$\mathbb{F}_{2^8}\f$, i.e. in 16
+ * bits as a1<<8 | a0. Multiplication in the tower only needs multiplications in
+ * \f$\mathbb{F}_{2^8}\f$, which are table driven and for which Newton-John tables have 256 rows. A
+ * matrix over the tower is a pair of matrices over \f$\mathbb{F}_{2^8}\f$ and the product of two
+ * such matrices costs three products over \f$\mathbb{F}_{2^8}\f$ (Karatsuba).
+ *
+ * The isomorphism to and from the polynomial basis of gf2e maps X to a root of gf2e::minpoly in
+ * the tower. It is \GF2-linear and hence applied to 16-bit elements with two 256-entry lookups or
+ * to bitsliced matrices with matrix additions only.
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+#ifndef M4RIE_TOWER_H
+#define M4RIE_TOWER_H
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2013 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GPL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <m4ri/m4ri.h>
+#include <m4rie/gf2e.h>
+#include <m4rie/mzed.h>
+#include <m4rie/mzd_slice.h>
+
+/**
+ * \brief Tower representation of a field \GF2E with e=16.
+ *
+ * \ingroup Definitions
+ */
+
+typedef struct {
+  const gf2e *ff;    /**< The field in polynomial basis. */
+  const gf2e *base;  /**< \f$\mathbb{F}_{2^8}\f$ with irreducible_polynomials[8][1], from gf2e_get(). */
+  word c;            /**< Y^2 = Y + c. */
+  word to[2][256];   /**< to[k][b] is the image of b<<(8k) in the tower. */
+  word from[2][256]; /**< from[k][b] is the preimage of b<<(8k) in the tower. */
+} gf2e_tower_t;
+
+/**
+ * \brief Create the tower representation of ff.
+ *
+ * \param ff Finite field with degree 16.
+ *
+ * \ingroup FiniteField
+ */
+
+gf2e_tower_t *gf2e_tower_init(const gf2e *ff);
+
+/**
+ * \brief Free T.
+ *
+ * \ingroup FiniteField
+ */
+
+void gf2e_tower_free(gf2e_tower_t *T);
+
+/**
+ * \brief Map a from the polynomial basis to the tower.
+ */
+
+static inline word gf2e_tower_to(const gf2e_tower_t *T, const word a) {
+  return T->to[0][a & 0xff] ^ T->to[1][a >> 8];
+}
+
+/**
+ * \brief Map a from the tower to the polynomial basis.
+ */
+
+static inline word gf2e_tower_from(const gf2e_tower_t *T, const word a) {
+  return T->from[0][a & 0xff] ^ T->from[1][a >> 8];
+}
+
+/**
+ * \brief a*b for a,b in the tower.
+ *
+ * (a1*Y + a0)(b1*Y + b0) = (a1*b1 + a1*b0 + a0*b1)*Y + a0*b0 + c*a1*b1
+ */
+
+static inline word gf2e_tower_mul(const gf2e_tower_t *T, const word a, const word b) {
+  const word a0 = a & 0xff, a1 = a >> 8;
+  const word b0 = b & 0xff, b1 = b >> 8;
+  const word p0 = gf2e_mul(T->base, a0, b0);
+  const word p2 = gf2e_mul(T->base, a1, b1);
+  const word p1 = gf2e_mul(T->base, a0 ^ a1, b0 ^ b1);
+  return (p1 ^ p0) << 8 | (p0 ^ gf2e_mul(T->base, T->c, p2));
+}
+
+/**
+ * \brief a^(-1) for a != 0 in the tower.
+ *
+ * (a1*Y + a0)(a1*Y + a0 + a1) = a0^2 + a0*a1 + c*a1^2 is in \f$\mathbb{F}_{2^8}\f$.
+ */
+
+static inline word gf2e_tower_inv(const gf2e_tower_t *T, const word a) {
+  const word a0 = a & 0xff, a1 = a >> 8;
+  const word n = gf2e_mul(T->base, a0, a0 ^ a1) ^ gf2e_mul(T->base, T->c, gf2e_mul(T->base, a1, a1));
+  const word ninv = gf2e_inv(T->base, n);
+  return gf2e_mul(T->base, a1, ninv) << 8 | gf2e_mul(T->base, a0 ^ a1, ninv);
+}
+
+/**
+ * \brief Matrix over the tower, A = x[1]*Y + x[0].
+ *
+ * \ingroup Definitions
+ */
+
+typedef struct {
+  mzed_t *x[2];             /**< Coefficients over gf2e_tower_t::base. */
+  rci_t nrows;              /**< Number of rows. */
+  rci_t ncols;              /**< Number of columns. */
+  const gf2e_tower_t *tower; /**< The tower. */
+} mzed_tower_t;
+
+/**
+ * \brief Create a new zero matrix of dimension m x n over the tower T.
+ *
+ * \ingroup Constructions
+ */
+
+mzed_tower_t *mzed_tower_init(const gf2e_tower_t *T, const rci_t m, const rci_t n);
+
+/**
+ * \brief Free a matrix created with mzed_tower_init().
+ *
+ * \ingroup Constructions
+ */
+
+void mzed_tower_free(mzed_tower_t *A);
+
+/**
+ * \brief Map A to the tower T.
+ *
+ * \param B Matrix over the tower or NULL.
+ * \param A Matrix over T->ff with offset zero.
+ * \param T Tower.
+ *
+ * \ingroup Constructions
+ */
+
+mzed_tower_t *mzed_to_tower(mzed_tower_t *B, const mzed_t *A, const gf2e_tower_t *T);
+
+/**
+ * \brief Map B from the tower back to the polynomial basis.
+ *
+ * \param A Matrix over B->tower->ff with offset zero or NULL.
+ * \param B Matrix over the tower.
+ *
+ * \ingroup Constructions
+ */
+
+mzed_t *mzed_from_tower(mzed_t *A, const mzed_tower_t *B);
+
+/**
+ * \brief Map the bitsliced matrix A to the tower T.
+ *
+ * \param B Matrix over the tower or NULL.
+ * \param A Bitsliced matrix over T->ff.
+ * \param T Tower.
+ *
+ * \ingroup Constructions
+ */
+
+mzed_tower_t *mzd_slice_to_tower(mzed_tower_t *B, const mzd_slice_t *A, const gf2e_tower_t *T);
+
+/**
+ * \brief Map B from the tower back to a bitsliced matrix in the polynomial basis.
+ *
+ * \param A Bitsliced matrix over B->tower->ff or NULL.
+ * \param B Matrix over the tower.
+ *
+ * \ingroup Constructions
+ */
+
+mzd_slice_t *mzd_slice_from_tower(mzd_slice_t *A, const mzed_tower_t *B);
+
+/**
+ * \brief C = A*B over the tower using three products over gf2e_tower_t::base.
+ *
+ * \param C Preallocated product matrix or NULL.
+ * \param A Input matrix A.
+ * \param B Input matrix B.
+ *
+ * \ingroup Multiplication
+ */
+
+mzed_tower_t *mzed_tower_mul(mzed_tower_t *C, const mzed_tower_t *A, const mzed_tower_t *B);
+
+/**
+ * \brief C = C + A*B over the tower.
+ *
+ * \param C Preallocated product matrix.
+ * \param A Input matrix A.
+ * \param B Input matrix B.
+ *
+ * \ingroup Multiplication
+ */
+
+mzed_tower_t *mzed_tower_addmul(mzed_tower_t *C, const mzed_tower_t *A, const mzed_tower_t *B);
+
+/**
+ * \brief C = A*B for matrices over T->ff computed in the tower T.
+ *
+ * \param C Preallocated product matrix or NULL.
+ * \param A Input matrix A.
+ * \param B Input matrix B.
+ * \param T Tower of A->finite_field.
+ *
+ * \ingroup Multiplication
+ */
+
+mzed_t *mzed_mul_tower(mzed_t *C, const mzed_t *A, const mzed_t *B, const gf2e_tower_t *T);
+
+#endif //M4RIE_TOWER_H
@@ -8,12 +8,25 @@ void mzed_trsm_upper_left_naive(const mzed_t *U, mzed_t *B) {
   assert(B->nrows == U->ncols);
 
   const gf2e *ff = U->finite_field;
+  word *diag = (word*)m4ri_mm_malloc(B->nrows * sizeof(word));
+  for(rci_t i=0; i<B->nrows; i++)
+    diag[i] = mzed_read_elem(U, i, i);
+  gf2e_inv_batch(ff, diag, diag, B->nrows);
+
+  rci_t *rows = (rci_t*)m4ri_mm_malloc(B->nrows * sizeof(rci_t));
+  word *scalars = (word*)m4ri_mm_malloc(B->nrows * sizeof(word));
+  for(rci_t k=0; k<B->nrows; k++)
+    rows[k] = k;
+
   for(int i=B->nrows-1; i>=0; i--) {
-    for(rci_t k=i+1; k<B->nrows; k++) {
-      mzed_add_multiple_of_row(B, i, B, k, mzed_read_elem(U, i, k), 0);
-    }
-    mzed_rescale_row(B, i, 0, gf2e_inv(ff, mzed_read_elem(U, i, i)));
+    for(rci_t k=i+1; k<B->nrows; k++)
+      scalars[k] = mzed_read_elem(U, i, k);
+    mzed_add_multiple_of_rows(B, i, B, rows + i + 1, scalars + i + 1, B->nrows - i - 1, 0);
+    mzed_rescale_row(B, i, 0, diag[i]);
   }
+  m4ri_mm_free(rows);
+  m4ri_mm_free(scalars);
+  m4ri_mm_free(diag);
 }
 
 void mzed_trsm_lower_left_naive(const mzed_t *L, mzed_t *B) {
@@ -22,12 +35,25 @@ void mzed_trsm_lower_left_naive(const mzed_t *L, mzed_t *B) {
   assert(B->nrows == L->ncols);
 
   const gf2e *ff = L->finite_field;
+  word *diag = (word*)m4ri_mm_malloc(B->nrows * sizeof(word));
+  for(rci_t i=0; i<B->nrows; i++)
+    diag[i] = mzed_read_elem(L, i, i);
+  gf2e_inv_batch(ff, diag, diag, B->nrows);
+
+  rci_t *rows = (rci_t*)m4ri_mm_malloc(B->nrows * sizeof(rci_t));
+  word *scalars = (word*)m4ri_mm_malloc(B->nrows * sizeof(word));
+  for(rci_t k=0; k<B->nrows; k++)
+    rows[k] = k;
+
   for(rci_t i=0; i<B->nrows; i++) {
-    for(rci_t k=0; k<i; k++) {
-      mzed_add_multiple_of_row(B, i, B, k, mzed_read_elem(L, i, k), 0);
-    }
-    mzed_rescale_row(B, i, 0, gf2e_inv(ff, mzed_read_elem(L, i, i)));
+    for(rci_t k=0; k<i; k++)
+      scalars[k] = mzed_read_elem(L, i, k);
+    mzed_add_multiple_of_rows(B, i, B, rows, scalars, i, 0);
+    mzed_rescale_row(B, i, 0, diag[i]);
   }
+  m4ri_mm_free(rows);
+  m4ri_mm_free(scalars);
+  m4ri_mm_free(diag);
 }
 
 void mzd_slice_trsm_upper_left_naive(const mzd_slice_t *U, mzd_slice_t *B) {
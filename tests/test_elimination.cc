@@ -66,16 +66,39 @@ int test_equality(gf2e *ff, rci_t m, rci_t n) {
   return fail_ret;
 }
 
+int test_rank(gf2e *ff, rci_t m, rci_t n) {
+  int fail_ret = 0;
+  m4rie_prng_t R;
+  m4rie_prng_seed(&R, 1000*m + n);
+
+  const rci_t ranks[3] = {0, MIN(m, n)/2, MIN(m, n)};
+  for(int i=0; i<3; i++) {
+    mzed_t *A = mzed_init(ff, m, n);
+    mzed_randomize_rank(A, ranks[i], m4rie_prng_next, &R);
+    m4rie_check( mzed_echelonize(A, 0) == ranks[i] );
+    mzed_free(A);
+  }
+
+  mzed_t *A = mzed_init(ff, m, m);
+  mzed_randomize_invertible(A, m4rie_prng_next, &R);
+  m4rie_check( mzed_echelonize_naive(A, 0) == m );
+  mzed_free(A);
+  return fail_ret;
+}
+
 int test_batch(gf2e *ff, rci_t m, rci_t n) {
   int fail_ret = 0;
-  printf("elim: k: %2d, minpoly: 0x%05x m: %5d, n: %5d ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)n);
+  printf("elim: k: %2d, minpoly: 0x%05llx m: %5d, n: %5d ",(int)ff->degree, (unsigned long long)ff->minpoly, (int)m, (int)n);
 
   if(m == n) {
     m4rie_check(   test_equality(ff, m, n) == 0); printf("."); fflush(0);
+    m4rie_check(       test_rank(ff, m, n) == 0); printf("."); fflush(0);
     printf(" ");
   } else {
     m4rie_check(   test_equality(ff, m, n) == 0); printf("."); fflush(0);
     m4rie_check(   test_equality(ff, n, m) == 0); printf("."); fflush(0);
+    m4rie_check(       test_rank(ff, m, n) == 0); printf("."); fflush(0);
+    m4rie_check(       test_rank(ff, n, m) == 0); printf("."); fflush(0);
   }
 
   if (fail_ret == 0)
@@ -125,5 +148,13 @@ int main(int argc, char **argv) {
     gf2e_free(ff);
   }
 
+  for(int k=17; k<=32; k++) {
+    ff = gf2e_init(irreducible_polynomials[k][1]);
+    fail_ret += test_batch(ff,   2,   5);
+    fail_ret += test_batch(ff,  11,  12);
+    fail_ret += test_batch(ff,  63,  65);
+    gf2e_free(ff);
+  }
+
   return fail_ret;
 }
@@ -113,12 +113,44 @@ int test_mul(gf2e *ff, rci_t m, rci_t n, rci_t l) {
   return fail_ret;
 }
 
+int test_mul_stripes(gf2e *ff, rci_t m, rci_t l) {
+  int fail_ret = 0;
+
+  /** two stripes of columns and a partial one, l % 8 columns of A are left over **/
+  const rci_t n = 2*_mzed_mul_newton_john_stripe_ncols(ff) + 3;
+  printf("mul stripes: k: %2d, m: %5d, l: %5d, n: %7d ", (int)ff->degree, (int)m, (int)l, (int)n);
+
+  mzed_t *A = random_mzed_t(ff, m, l);
+  mzed_t *B = random_mzed_t(ff, l, n);
+  mzed_t *C0 = random_mzed_t(ff, m, n);
+  mzed_t *C1 = mzed_copy(NULL, C0);
+
+  mzed_addmul_newton_john(C0, A, B);
+  mzed_addmul_naive(C1, A, B);
+  m4rie_check( mzed_cmp(C0, C1) == 0 );
+
+  m4rie_check( mzed_canary_is_alive(A) );
+  m4rie_check( mzed_canary_is_alive(B) );
+  m4rie_check( mzed_canary_is_alive(C0) );
+
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(C0);
+  mzed_free(C1);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+  return fail_ret;
+}
+
 int test_scalar(gf2e *ff, rci_t m, rci_t n) {
   int fail_ret = 0;
 
-  word a = random() & ((1<<ff->degree)-1);
+  word a = random() & __M4RI_LEFT_BITMASK(ff->degree);
   while (!a)
-    a = random() & ((1<<ff->degree)-1);
+    a = random() & __M4RI_LEFT_BITMASK(ff->degree);
   mzed_t *B = random_mzed_t(ff, m, n);
 
   mzed_t *C0 = mzed_init(ff, m, n);
@@ -169,9 +201,226 @@ int test_scalar(gf2e *ff, rci_t m, rci_t n) {
 }
 
 
+int test_mul_empty(gf2e *ff, rci_t m, rci_t n) {
+  int fail_ret = 0;
+  printf("mul: k: %2d, minpoly: 0x%05x m: %5d, n: %5d, empty ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)n);
+
+  /** m x n times n x 0, 0 x n times n x m and m x 0 times 0 x n **/
+  const rci_t dims[3][3] = {{m, n, 0}, {0, n, m}, {m, 0, n}};
+
+  for(int d=0; d<3; d++) {
+    mzed_t *A = mzed_init(ff, dims[d][0], dims[d][1]);
+    mzed_t *B = mzed_init(ff, dims[d][1], dims[d][2]);
+    mzed_randomize(A);
+    mzed_randomize(B);
+
+    mzed_t *C0 = mzed_mul(NULL, A, B);
+    m4rie_check( mzed_is_zero(C0) );
+
+    mzed_t *C1 = mzed_init(ff, dims[d][0], dims[d][2]);
+    mzed_randomize(C1);
+    mzed_t *C2 = mzed_copy(NULL, C1);
+    _mzed_mul_naive(C1, A, B);
+    m4rie_check( mzed_cmp(C1, C2) == 0 );
+
+    mzed_free(A);
+    mzed_free(B);
+    mzed_free(C0);
+    mzed_free(C1);
+    mzed_free(C2);
+    printf("."); fflush(0);
+  }
+
+  if (fail_ret == 0)
+    printf("                    passed\n");
+  else
+    printf("                    FAILED\n");
+
+  return fail_ret;
+}
+
+int test_tower(gf2e *ff, rci_t m, rci_t l, rci_t n) {
+  int fail_ret = 0;
+  printf("tower: minpoly: 0x%05llx m: %5d, l: %5d, n: %5d ", (unsigned long long)ff->minpoly, (int)m, (int)l, (int)n);
+
+  gf2e_tower_t *T = gf2e_tower_init(ff);
+
+  for(word a=1; a<__M4RI_TWOPOW(16); a+=97) {
+    const word b = random() & 0xffff;
+    m4rie_check( gf2e_tower_from(T, gf2e_tower_to(T, a)) == a );
+    m4rie_check( gf2e_tower_mul(T, gf2e_tower_to(T, a), gf2e_tower_to(T, b)) == gf2e_tower_to(T, ff->mul(ff, a, b)) );
+    m4rie_check( gf2e_tower_inv(T, gf2e_tower_to(T, a)) == gf2e_tower_to(T, gf2e_inv(ff, a)) );
+  }
+  printf("."); fflush(0);
+
+  mzed_t *A = random_mzed_t(ff, m, l);
+  mzed_t *B = random_mzed_t(ff, l, n);
+  mzed_t *C0 = mzed_mul(NULL, A, B);
+  mzed_t *C1 = mzed_mul_tower(NULL, A, B, T);
+  m4rie_check( mzed_cmp(C0, C1) == 0 );
+  printf("."); fflush(0);
+
+  /** C0 + A*B via bitsliced conversions **/
+  mzd_slice_t *As = mzed_slice(NULL, A);
+  mzd_slice_t *Bs = mzed_slice(NULL, B);
+  mzd_slice_t *Cs = mzed_slice(NULL, C0);
+  mzed_tower_t *At = mzd_slice_to_tower(NULL, As, T);
+  mzed_tower_t *Bt = mzd_slice_to_tower(NULL, Bs, T);
+  mzed_tower_t *Ct = mzd_slice_to_tower(NULL, Cs, T);
+  mzed_tower_addmul(Ct, At, Bt);
+  mzd_slice_from_tower(Cs, Ct);
+  mzed_cling(C1, Cs);
+  m4rie_check( mzed_is_zero(C1) );
+  printf("."); fflush(0);
+
+  mzed_tower_free(At);
+  mzed_tower_free(Bt);
+  mzed_tower_free(Ct);
+  mzd_slice_free(As);
+  mzd_slice_free(Bs);
+  mzd_slice_free(Cs);
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(C0);
+  mzed_free(C1);
+  gf2e_tower_free(T);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
+/**
+ * Blocks of rows of a matrix in memory, see mzed_mul_stream().
+ */
+
+static rci_t read_rows(mzed_t *A, const rci_t row, void *state) {
+  const mzed_t *M = (const mzed_t*)state;
+  const rci_t k = MIN(A->nrows, M->nrows - row);
+  for(rci_t i=0; i<k; i++)
+    for(rci_t j=0; j<M->ncols; j++)
+      mzed_write_elem(A, i, j, mzed_read_elem(M, row + i, j));
+  return k;
+}
+
+static int write_rows(const mzed_t *C, const rci_t row, void *state) {
+  mzed_t *M = (mzed_t*)state;
+  for(rci_t i=0; i<C->nrows; i++)
+    for(rci_t j=0; j<C->ncols; j++)
+      mzed_write_elem(M, row + i, j, mzed_read_elem(C, i, j));
+  return 0;
+}
+
+int test_stream(gf2e *ff, rci_t m, rci_t l, rci_t n, rci_t block_rows) {
+  int fail_ret = 0;
+  printf("stream: k: %2d, m: %5d, l: %5d, n: %5d, block: %4d ", (int)ff->degree, (int)m, (int)l, (int)n, (int)block_rows);
+
+  mzed_t *A = random_mzed_t(ff, m, l);
+  mzed_t *B = random_mzed_t(ff, l, n);
+  mzed_t *C0 = mzed_mul(NULL, A, B);
+  mzed_t *C1 = mzed_init(ff, m, n);
+
+  m4rie_check( (mzed_mul_stream(B, block_rows, read_rows, A, write_rows, C1) == m) );
+  m4rie_check( mzed_cmp(C0, C1) == 0 );
+  printf("."); fflush(0);
+
+  char A_filename[] = "/tmp/m4rie_test_XXXXXX";
+  char C_filename[] = "/tmp/m4rie_test_XXXXXX";
+  close(mkstemp(A_filename));
+  close(mkstemp(C_filename));
+  m4rie_check( (mzed_write_file(A, A_filename) == 0) );
+  m4rie_check( (mzed_mul_file(C_filename, A_filename, B, block_rows) == 0) );
+  mzed_t *C2 = mzed_map_file(ff, C_filename);
+  m4rie_check( (C2 != NULL && mzed_cmp(C0, C2) == 0) );
+  if (C2)
+    mzed_unmap_file(C2);
+  m4rie_check( (mzed_mul_file(C_filename, A_filename, A, block_rows) == -1 || l == m) );
+  unlink(A_filename);
+  unlink(C_filename);
+  printf("."); fflush(0);
+
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(C0);
+  mzed_free(C1);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
+int test_sparse(gf2e *ff, rci_t m, rci_t l, rci_t n) {
+  int fail_ret = 0;
+  printf("sparse: k: %2d, m: %5d, l: %5d, n: %5d ", (int)ff->degree, (int)m, (int)l, (int)n);
+
+  /** about one in eight entries is non-zero, the first row is zero **/
+  mzed_t *A = random_mzed_t(ff, m, l);
+  size_t nnz = 0;
+  for(rci_t i=0; i<m; i++)
+    for(rci_t j=0; j<l; j++) {
+      if (i == 0 || random() % 8)
+        mzed_write_elem(A, i, j, 0);
+      nnz += (mzed_read_elem(A, i, j) != 0);
+    }
+
+  mzes_t *S = mzes_from_mzed(A);
+  mzed_t *D = mzes_to_mzed(NULL, S);
+  m4rie_check( (S->nnz == nnz) );
+  m4rie_check( mzed_cmp(A, D) == 0 );
+  for(rci_t i=0; i<m; i++)
+    for(rci_t j=0; j<l; j++)
+      fail_ret += (mzes_read_elem(S, i, j) != mzed_read_elem(A, i, j));
+  printf("."); fflush(0);
+
+  mzed_t *B = random_mzed_t(ff, l, n);
+  mzed_t *C0 = mzed_mul(NULL, A, B);
+  mzed_t *C1 = mzes_mul(NULL, S, B);
+  m4rie_check( mzed_cmp(C0, C1) == 0 );
+
+  mzed_t *C2 = random_mzed_t(ff, m, n);
+  mzed_t *C3 = mzed_copy(NULL, C2);
+  mzed_set_canary(C2);
+  mzed_addmul(C3, A, B);
+  mzes_addmul(C2, S, B);
+  m4rie_check( mzed_canary_is_alive(C2) );
+  m4rie_check( mzed_cmp(C2, C3) == 0 );
+  printf("."); fflush(0);
+
+  mzed_t *x = random_mzed_t(ff, l, 1);
+  mzed_t *y0 = mzed_mul(NULL, A, x);
+  mzed_t *y1 = mzes_mul_vector(NULL, S, x);
+  m4rie_check( mzed_cmp(y0, y1) == 0 );
+  printf("."); fflush(0);
+
+  mzes_free(S);
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(D);
+  mzed_free(C0);
+  mzed_free(C1);
+  mzed_free(C2);
+  mzed_free(C3);
+  mzed_free(x);
+  mzed_free(y0);
+  mzed_free(y1);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
 int test_batch(gf2e *ff, rci_t m, rci_t l, rci_t n) {
   int fail_ret = 0;
-  printf("mul: k: %2d, minpoly: 0x%05x m: %5d, l: %5d, n: %5d ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)l, (int)n);
+  printf("mul: k: %2d, minpoly: 0x%05llx m: %5d, l: %5d, n: %5d ",(int)ff->degree, (unsigned long long)ff->minpoly, (int)m, (int)l, (int)n);
 
   m4rie_check(test_scalar(ff, m, m) == 0); printf("."); fflush(0);
   m4rie_check(test_scalar(ff, l, l) == 0); printf("."); fflush(0);
@@ -230,7 +479,39 @@ int main(int argc, char **argv) {
       fail_ret += test_batch(ff, 127, 128, 129);
       fail_ret += test_batch(ff, 200,  20, 112);
     }
+    fail_ret += test_mul_empty(ff, 13, 7);
+    fail_ret += test_mul_stripes(ff, 17, 24);
+    fail_ret += test_mul_stripes(ff, 17, 27);
+    /** narrow rows and many elements use gf2e_mul_table_get() **/
+    fail_ret += test_scalar(ff, 1031, 11);
+    fail_ret += test_stream(ff, 200, 65, 70, 64);
+    if(k<=4 || runlong)
+      fail_ret += test_stream(ff, 1100, 512, 512, 512);
+    fail_ret += test_sparse(ff, 65, 130, 70);
+
+    gf2e_free(ff);
+  }
+
+  for(int k=17; k<=32; k++) {
+    ff = gf2e_init(irreducible_polynomials[k][1]);
+
+    fail_ret += test_batch(ff,   1,   1,   1);
+    fail_ret += test_batch(ff,  13,   2,  90);
+    fail_ret += test_batch(ff,  63,  64,  65);
+    if(runlong)
+      fail_ret += test_batch(ff, 127, 128, 129);
+    fail_ret += test_stream(ff, 130, 64, 64, 64);
+    fail_ret += test_sparse(ff, 65, 130, 70);
+
+    gf2e_free(ff);
+  }
 
+  for(int i=1; i<=2; i++) {
+    ff = gf2e_init(irreducible_polynomials[16][i]);
+    fail_ret += test_tower(ff,   1,   1,   1);
+    fail_ret += test_tower(ff,  11,  12,  13);
+    fail_ret += test_tower(ff,  63,  64,  65);
+    fail_ret += test_tower(ff, 200,  20, 112);
     gf2e_free(ff);
   }
 
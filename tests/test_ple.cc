@@ -170,7 +170,7 @@ int test_batch(gf2e *ff, const rci_t m, const rci_t n, const rci_t r) {
   assert(r <= m);
   assert(r <= n);
 
-  printf("ple: k: %2d, minpoly: 0x%05x m: %5d, n: %5d, r: %5d ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)n, (int)r);
+  printf("ple: k: %2d, minpoly: 0x%05llx m: %5d, n: %5d, r: %5d ",(int)ff->degree, (unsigned long long)ff->minpoly, (int)m, (int)n, (int)r);
 
   int fail_ret = 0;
 
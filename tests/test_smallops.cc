@@ -25,13 +25,181 @@
 ******************************************************************************/
 
 #include "testing.h"
+extern "C" {
+#include <m4rie/gf2e_tables.h>
+}
 
 int test_gf2e(gf2e *ff) {
   int fail_ret = 0;
-  for(word a=1; a < __M4RI_TWOPOW(ff->degree); a++) {
+  /** all elements for small fields, about 4096 of them otherwise **/
+  const word step = (ff->degree <= 16) ? 1 : __M4RI_TWOPOW(ff->degree - 12) + 1;
+  for(word a=1; a < __M4RI_TWOPOW(ff->degree); a += step) {
     word a_inv = ff->inv(ff, a);
     fail_ret += ((a == ff->inv(ff, a_inv)) ^ 1);
+    fail_ret += (a_inv != _gf2e_inv_arith(ff, a));
+    fail_ret += (ff->mul(ff, a, a_inv) != 1);
+
+    word b = random() & __M4RI_LEFT_BITMASK(ff->degree);
+    fail_ret += (ff->mul(ff, a, b) != _gf2e_mul_arith(ff, a, b));
+    fail_ret += (gf2e_mul(ff, a, b) != gf2e_mul(ff, b, a));
+    fail_ret += (gf2e_pow(ff, a, __M4RI_TWOPOW(ff->degree) - 1) != 1);
+  }
+
+  const size_t n = 129;
+  word *in = (word*)m4ri_mm_malloc(n * sizeof(word));
+  word *out0 = (word*)m4ri_mm_malloc(n * sizeof(word));
+  word *out1 = (word*)m4ri_mm_malloc(n * sizeof(word));
+  for(size_t i=0; i<n; i++)
+    in[i] = (i%7 == 3) ? 0 : random() & __M4RI_LEFT_BITMASK(ff->degree);
+
+  gf2e_inv_batch(ff, out0, in, n);
+  _gf2e_inv_batch_montgomery(ff, out1, in, n);
+  for(size_t i=0; i<n; i++) {
+    fail_ret += (out0[i] != ((in[i]) ? gf2e_inv(ff, in[i]) : 0));
+    fail_ret += (out1[i] != out0[i]);
+  }
+
+  gf2e_mul_vec(ff, out1, in, out0, n);
+  for(size_t i=0; i<n; i++)
+    fail_ret += (out1[i] != gf2e_mul(ff, in[i], out0[i]));
+
+  m4ri_mm_free(in);
+  m4ri_mm_free(out0);
+  m4ri_mm_free(out1);
+  return fail_ret;
+}
+
+int test_gf2e_registry() {
+  int fail_ret = 0;
+  const gf2e *ff = gf2e_get(irreducible_polynomials[16][1]);
+  const gf2e *gg = gf2e_get(irreducible_polynomials[16][1]);
+  const gf2e *hh = gf2e_get(irreducible_polynomials[16][2]);
+
+  m4rie_check((ff == gg));
+  m4rie_check((ff != hh));
+  m4rie_check((hh->minpoly == irreducible_polynomials[16][2]));
+
+  gf2e_release(ff);
+  gf2e_registry_clear();
+  m4rie_check((gf2e_get(irreducible_polynomials[16][1]) == gg));
+
+  gf2e_release(gg);
+  gf2e_release(gg);
+  gf2e_release(hh);
+  gf2e_registry_clear();
+  return fail_ret;
+}
+
+int test_gf2e_static_tables() {
+  int fail_ret = 0;
+  printf("static tables:");
+
+  /** the default fields use the tables generated by gf2e_tables_gen **/
+  for(int k=2; k<=M4RIE_MAX_TABLE_DEGREE; k++) {
+    const gf2e_static_tables_t *st = gf2e_static_tables_get(irreducible_polynomials[k][1]);
+    m4rie_check( st != NULL );
+    if (st == NULL)
+      continue;
+
+    gf2e *ff = gf2e_init(irreducible_polynomials[k][1]);
+    m4rie_check( ff->red == st->red && ff->pow_gen == st->pow_gen );
+    m4rie_check( ff->_inv == st->inv );
+    if (k <= 8)
+      m4rie_check( (const word *const *)ff->_mul == st->mul );
+    if (9 <= k && k <= 12)
+      m4rie_check( ff->_log == st->log && ff->_exp == st->exp );
+    gf2e_free(ff);
+
+    if (irreducible_polynomials[k][0] > 1)
+      m4rie_check( gf2e_static_tables_get(irreducible_polynomials[k][2]) == NULL );
+  }
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+  return fail_ret;
+}
+
+int test_gf2e_mul_tables(gf2e *ff) {
+  int fail_ret = 0;
+  const word a = 1 + (random() % (__M4RI_TWOPOW(ff->degree) - 1));
+  const unsigned int w = gf2e_degree_to_w(ff);
+
+  const word *mul = gf2e_mul_table_get(ff, a);
+  for(int t=0; t<1024; t++) {
+    word v = random() & __M4RI_LEFT_BITMASK(16);
+    for(unsigned int i=0; i<16; i+=w)
+      v &= ~(~__M4RI_LEFT_BITMASK(ff->degree) << i);
+
+    word r = 0;
+    for(unsigned int i=0; i<16; i+=w)
+      r |= gf2e_mul(ff, a, (v >> i) & __M4RI_LEFT_BITMASK(w)) << i;
+
+    if (ff->degree <= 8)
+      fail_ret += (mul[v] != r);
+    else
+      fail_ret += ((mul[v & 0xff] ^ mul[256 + (v >> 8)]) != r);
+  }
+
+  /** the table we hold survives eviction, the others are rebuilt **/
+  for(word b=1; b <= 2*M4RIE_MUL_TABLE_CACHE_SIZE; b++)
+    gf2e_mul_table_release(gf2e_mul_table_get(ff, 1 + (a + b) % (__M4RI_TWOPOW(ff->degree) - 1)));
+  m4rie_check((gf2e_mul_table_get(ff, a) == mul));
+  gf2e_mul_table_release(mul);
+  gf2e_mul_table_release(mul);
+  gf2e_mul_table_clear();
+  return fail_ret;
+}
+
+int test_njt_pool(gf2e *ff, rci_t n) {
+  int fail_ret = 0;
+  mzed_t *A = random_mzed_t(ff, 2, n);
+
+  /** released tables are handed out again for the same field and width only **/
+  njt_mzed_t *T0 = njt_mzed_get(ff, n);
+  njt_mzed_release(T0);
+  njt_mzed_t *T1 = njt_mzed_get(ff, n);
+  njt_mzed_t *T2 = njt_mzed_get(ff, n);
+  njt_mzed_t *T3 = njt_mzed_get(ff, n + 1);
+  m4rie_check( (T1 == T0) );
+  m4rie_check( (T2 != T1) );
+  m4rie_check( (T3 != T0 && T3->T->ncols == n + 1) );
+
+  /** a reused table gives the same result as a fresh one **/
+  mzed_make_table(T1, A, 1, n - 1);
+  njt_mzed_release(T1);
+  T1 = njt_mzed_get(ff, n);
+  njt_mzed_t *T4 = njt_mzed_init(ff, n);
+  mzed_make_table(T1, A, 0, 0);
+  mzed_make_table(T4, A, 0, 0);
+  m4rie_check( mzed_cmp(T1->T, T4->T) == 0 );
+  for(rci_t a=0; a<T1->T->nrows; a++)
+    fail_ret += (T1->L[a] != T4->L[a]);
+  if (ff->degree > M4RIE_NJT_SPLIT_DEGREE) {
+    m4rie_check( mzed_cmp(T1->T1, T4->T1) == 0 );
+    for(rci_t a=0; a<T1->T1->nrows; a++)
+      fail_ret += (T1->L1[a] != T4->L1[a]);
+  }
+  m4rie_check( (T1->T->nrows + (T1->T1 ? T1->T1->nrows : 0) == njt_mzed_rows(ff)) );
+
+  /** row a of the (split) table is a times the row of A **/
+  for(int t=0; t<16; t++) {
+    const word a = random() & __M4RI_LEFT_BITMASK(ff->degree);
+    for(rci_t j=0; j<n; j++) {
+      word b = mzed_read_elem(T1->T, T1->L[a & __M4RI_LEFT_BITMASK(M4RIE_NJT_SPLIT_DEGREE)], j);
+      if (T1->T1)
+        b ^= mzed_read_elem(T1->T1, T1->L1[a >> M4RIE_NJT_SPLIT_DEGREE], j);
+      fail_ret += (b != gf2e_mul(ff, a, mzed_read_elem(A, 0, j)));
+    }
   }
+
+  njt_mzed_release(T1);
+  njt_mzed_release(T2);
+  njt_mzed_release(T3);
+  njt_mzed_free(T4);
+  njt_mzed_clear();
+  mzed_free(A);
   return fail_ret;
 }
 
@@ -76,7 +244,7 @@ int test_slice_known_answers(gf2e *ff, int m, int n) {
   mzd_set_ui(one, 1);
 
   for(int j=0; j<ff->degree; j++) {
-    mzed_set_ui(A, 1<<j);
+    mzed_set_ui(A, __M4RI_TWOPOW(j));
     mzd_slice_t *a = mzed_slice(NULL, A);
 
     for(int i=0; i<a->depth; i++) {
@@ -97,6 +265,63 @@ int test_slice_known_answers(gf2e *ff, int m, int n) {
   return fail_ret;
 }
 
+int test_rowops(gf2e *ff, int m, int n) {
+  int fail_ret = 0;
+
+  mzed_t *A = random_mzed_t(ff, m, n);
+  mzed_t *B = random_mzed_t(ff, m, n);
+  mzed_t *C = mzed_copy(NULL, A);
+  mzed_set_canary(A);
+
+  for(rci_t r=0; r<m; r++) {
+    const word x = random() & __M4RI_LEFT_BITMASK(ff->degree);
+    const rci_t c = random() % n;
+    mzed_add_multiple_of_row(A, r, B, r, x, c);
+    for(rci_t j=c; j<n; j++)
+      mzed_add_elem(C, r, j, ff->mul(ff, x, mzed_read_elem(B, r, j)));
+
+    const word y = random() & __M4RI_LEFT_BITMASK(ff->degree);
+    const rci_t d = random() % n;
+    mzed_rescale_row(A, r, d, y);
+    for(rci_t j=d; j<n; j++)
+      mzed_write_elem(C, r, j, ff->mul(ff, y, mzed_read_elem(C, r, j)));
+  }
+
+  /** more rows than one call of the kernel takes **/
+  const int kmax = 2*__M4RIE_SIMD_MAX_ROWS + 3;
+  rci_t rows[kmax];
+  word scalars[kmax];
+  for(rci_t r=0; r<m; r++) {
+    const int k = random() % (kmax + 1);
+    const rci_t c = random() % n;
+    for(int i=0; i<k; i++) {
+      rows[i] = random() % m;
+      scalars[i] = (i%5 == 1) ? 0 : random() & __M4RI_LEFT_BITMASK(ff->degree);
+      for(rci_t j=c; j<n; j++)
+        mzed_add_elem(C, r, j, ff->mul(ff, scalars[i], mzed_read_elem(B, rows[i], j)));
+    }
+    mzed_add_multiple_of_rows(A, r, B, rows, scalars, k, c);
+  }
+
+  /** empty rows are left alone **/
+  for(int i=0; i<kmax; i++) {
+    rows[i] = random() % m;
+    scalars[i] = 1;
+  }
+  mzed_add_multiple_of_rows(A, 0, B, rows, scalars, kmax, n);
+  mzed_t *E = mzed_init(ff, m, 0);
+  mzed_add_multiple_of_rows(E, 0, E, rows, scalars, kmax, 0);
+  mzed_free(E);
+
+  m4rie_check( mzed_cmp(A, C) == 0 );
+  m4rie_check( mzed_canary_is_alive(A) );
+
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(C);
+  return fail_ret;
+}
+
 int test_add(gf2e *ff, int m, int n) {
   int fail_ret = 0;
 
@@ -158,6 +383,221 @@ int test_add(gf2e *ff, int m, int n) {
   return fail_ret; 
 }
 
+int test_combine(gf2e *ff, int m, int n) {
+  int fail_ret = 0;
+
+  mzed_t *A = random_mzed_t(ff, m, m);
+  mzed_t *B = random_mzed_t(ff, m, n);
+  mzed_t *C0 = mzed_mul_naive(NULL, A, B);
+  mzed_t *C1 = mzed_mul_newton_john(NULL, A, B);
+
+  m4rie_check( mzed_cmp(C0, C1) == 0 );
+
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(C0);
+  mzed_free(C1);
+  return fail_ret;
+}
+
+int test_randomize(gf2e *ff, int m, int n) {
+  int fail_ret = 0;
+  m4rie_prng_t R0, R1;
+  m4rie_prng_seed(&R0, 42);
+  m4rie_prng_seed(&R1, 42);
+
+  mzed_t *A = mzed_init(ff, m, n);
+  mzed_t *B = mzed_init(ff, m, n);
+  mzed_set_canary(A);
+  mzed_set_canary(B);
+  mzed_randomize_rng(A, m4rie_prng_next, &R0);
+  mzed_randomize_rng(B, m4rie_prng_next, &R1);
+
+  m4rie_check( mzed_cmp(A, B) == 0 );
+  m4rie_check( mzed_canary_is_alive(A) );
+  for(rci_t i=0; i<m; i++)
+    for(rci_t j=0; j<n; j++)
+      fail_ret += ((mzed_read_elem(A, i, j) >> ff->degree) != 0);
+
+  /** a window only touches its own columns **/
+  if (n > 1) {
+    mzed_t *W = mzed_init_window(B, 0, 1, m, n);
+    mzed_randomize_rng(W, m4rie_prng_next, &R0);
+    for(rci_t i=0; i<m; i++)
+      fail_ret += (mzed_read_elem(B, i, 0) != mzed_read_elem(A, i, 0));
+    mzed_free_window(W);
+  }
+
+  mzd_slice_t *S = mzd_slice_init(ff, m, n);
+  mzd_slice_set_canary(S);
+  mzd_slice_randomize_rng(S, m4rie_prng_next, &R1);
+  m4rie_check( mzd_slice_canary_is_alive(S) );
+
+  mzd_slice_free(S);
+  mzed_free(A);
+  mzed_free(B);
+  return fail_ret;
+}
+
+int test_io(gf2e *ff, int m, int n) {
+  int fail_ret = 0;
+  const m4rie_format_t formats[] = {M4RIE_FORMAT_PLAIN, M4RIE_FORMAT_SAGE, M4RIE_FORMAT_MATRIX_MARKET};
+
+  mzed_t *A = mzed_init(ff, m, n);
+  mzed_randomize(A);
+  mzd_slice_t *S = mzed_slice(NULL, A);
+
+  for(int f=0; f<3; f++) {
+    char *str = mzed_to_string(A, formats[f]);
+    mzed_t *B = mzed_from_string(ff, str, formats[f]);
+    m4rie_check( B != NULL && mzed_cmp(A, B) == 0 );
+    mzed_free(B);
+
+    mzd_slice_t *T = mzd_slice_from_string(ff, str, formats[f]);
+    m4rie_check( T != NULL && mzd_slice_cmp(S, T) == 0 );
+    mzd_slice_free(T);
+
+    char *str2 = mzd_slice_to_string(S, formats[f]);
+    m4rie_check( strcmp(str, str2) == 0 );
+    free(str2);
+
+    FILE *fh = tmpfile();
+    m4rie_check( mzed_fprint(fh, A, formats[f]) == 0 );
+    rewind(fh);
+    B = mzed_fscan(fh, ff, formats[f]);
+    m4rie_check( B != NULL && mzed_cmp(A, B) == 0 );
+    mzed_free(B);
+    fclose(fh);
+    free(str);
+  }
+
+  /** the plain format is what mzed_print() used to print **/
+  const int width = (A->w + 3)/4;
+  char *expected = (char*)malloc(m*(n*(width+1) + 3) + 1);
+  char *e = expected;
+  *e = '\0';
+  for(rci_t i=0; i<m; i++) {
+    e += sprintf(e, "[");
+    for(rci_t j=0; j<n; j++)
+      e += sprintf(e, (j < n-1) ? "%*x " : "%*x", width, (int)mzed_read_elem(A, i, j));
+    e += sprintf(e, "]\n");
+  }
+  char *str = mzed_to_string(A, M4RIE_FORMAT_PLAIN);
+  m4rie_check( strcmp(expected, str) == 0 );
+  free(expected);
+  free(str);
+
+  /** malformed input **/
+  m4rie_check( mzed_from_string(ff, "[1 2]\n[3]\n", M4RIE_FORMAT_PLAIN) == NULL );
+  m4rie_check( mzed_from_string(ff, "[1 2]\n[3 x]\n", M4RIE_FORMAT_PLAIN) == NULL );
+  m4rie_check( mzed_from_string(ff, "[[1, 2], [3, 4]", M4RIE_FORMAT_SAGE) == NULL );
+  m4rie_check( mzed_from_string(ff, "[1 2]", M4RIE_FORMAT_SAGE) == NULL );
+  m4rie_check( mzed_from_string(ff, "[[1, 2]][[3, 4]]", M4RIE_FORMAT_SAGE) == NULL );
+  m4rie_check( mzed_from_string(ff, "", M4RIE_FORMAT_SAGE) == NULL );
+  m4rie_check( mzed_from_string(ff, "%%MatrixMarket matrix coordinate integer general\n2 2 1\n3 1 1\n", M4RIE_FORMAT_MATRIX_MARKET) == NULL );
+  char mm[160];
+  sprintf(mm, "%%%%MatrixMarket matrix coordinate integer general\n%% GF(2^%u) modulus 0x%llx\n1 1 0\n",
+          ff->degree, (unsigned long long)(ff->minpoly ^ 2));
+  m4rie_check( mzed_from_string(ff, mm, M4RIE_FORMAT_MATRIX_MARKET) == NULL );
+  char elem[32];
+  sprintf(elem, "[%llx]", 1ULL << ff->degree);
+  m4rie_check( mzed_from_string(ff, elem, M4RIE_FORMAT_PLAIN) == NULL );
+
+  mzd_slice_free(S);
+  mzed_free(A);
+  return fail_ret;
+}
+
+int test_file(gf2e *ff, int m, int n) {
+  int fail_ret = 0;
+  char filename[] = "/tmp/m4rie_test_XXXXXX";
+  int fd = mkstemp(filename);
+  m4rie_check( (fd >= 0) );
+  close(fd);
+
+  mzed_t *A = mzed_init(ff, m, n);
+  mzed_randomize(A);
+  m4rie_check( (mzed_write_file(A, filename) == 0) );
+
+  mzed_t *B = mzed_map_file(ff, filename);
+  m4rie_check( (B != NULL && mzed_cmp(A, B) == 0) );
+  if (m && n) {
+    /** changes are private to the mapping **/
+    mzed_write_elem(B, 0, 0, mzed_read_elem(B, 0, 0) ^ 1);
+    mzed_t *C = mzed_map_file(ff, filename);
+    m4rie_check( (mzed_cmp(A, C) == 0) );
+    mzed_unmap_file(C);
+  }
+  mzed_unmap_file(B);
+
+  /** windows are written without their surroundings **/
+  if (n > 1) {
+    mzed_t *W = mzed_init_window(A, 0, 1, m, n);
+    m4rie_check( (mzed_write_file(W, filename) == 0) );
+    B = mzed_map_file(ff, filename);
+    m4rie_check( (B != NULL && mzed_cmp(W, B) == 0) );
+    mzed_unmap_file(B);
+    mzed_free_window(W);
+  }
+
+  mzd_slice_t *S = mzed_slice(NULL, A);
+  m4rie_check( (mzd_slice_write_file(S, filename) == 0) );
+  mzd_slice_t *T = mzd_slice_map_file(ff, filename);
+  m4rie_check( (T != NULL && mzd_slice_cmp(S, T) == 0) );
+  mzd_slice_unmap_file(T);
+
+  /** the file records the field and the representation **/
+  m4rie_check( (mzed_map_file(ff, filename) == NULL) );
+  gf2e *ff2 = gf2e_init(irreducible_polynomials[ff->degree == 2 ? 3 : 2][1]);
+  m4rie_check( (mzd_slice_map_file(ff2, filename) == NULL) );
+  gf2e_free(ff2);
+
+  mzd_slice_free(S);
+  mzed_free(A);
+  unlink(filename);
+  return fail_ret;
+}
+
+int test_transpose(gf2e *ff, int m, int n) {
+  int fail_ret = 0;
+
+  mzed_t *A = random_mzed_t(ff, m, n);
+  mzed_t *C = random_mzed_t(ff, n, m);
+  mzed_set_canary(C);
+  mzed_transpose(C, A);
+  m4rie_check( mzed_canary_is_alive(C) );
+
+  for(rci_t i=0; i<m; i++)
+    for(rci_t j=0; j<n; j++)
+      fail_ret += (mzed_read_elem(A, i, j) != mzed_read_elem(C, j, i));
+
+  mzed_t *B = mzed_transpose(NULL, C);
+  m4rie_check( mzed_cmp(A, B) == 0 );
+
+  if (n > 1) {
+    mzed_t *W = mzed_init_window(A, 0, 1, m, n);
+    mzed_t *D = mzed_transpose(NULL, W);
+    for(rci_t i=0; i<m; i++)
+      for(rci_t j=0; j<n-1; j++)
+        fail_ret += (mzed_read_elem(W, i, j) != mzed_read_elem(D, j, i));
+    mzed_free(D);
+    mzed_free_window(W);
+  }
+
+  mzd_slice_t *a = mzed_slice(NULL, A);
+  mzd_slice_t *c = mzd_slice_transpose(NULL, a);
+  mzd_slice_t *d = mzed_slice(NULL, C);
+  m4rie_check( mzd_slice_cmp(c, d) == 0 );
+
+  mzd_slice_free(a);
+  mzd_slice_free(c);
+  mzd_slice_free(d);
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(C);
+  return fail_ret;
+}
+
 int test_batch(gf2e *ff, int m, int n) {
   int fail_ret = 0;
   printf("testing k: %2d, m: %4d, n: %4d ",ff->degree,m,n);
@@ -178,7 +618,15 @@ int test_batch(gf2e *ff, int m, int n) {
   m4rie_check( test_add(ff, n, n) == 0) ;   printf("."); fflush(0);
   m4rie_check( test_slice_known_answers(ff, n, n) == 0); printf("."); fflush(0);
 
+  m4rie_check( test_rowops(ff, m, n) == 0); printf("."); fflush(0);
+  m4rie_check( test_rowops(ff, n, n) == 0); printf("."); fflush(0);
+  m4rie_check( test_transpose(ff, m, n) == 0); printf("."); fflush(0);
+  m4rie_check( test_transpose(ff, n, m) == 0); printf("."); fflush(0);
+
   m4rie_check( test_gf2e(ff) == 0); printf("."); fflush(0);
+  m4rie_check( test_randomize(ff, m, n) == 0); printf("."); fflush(0);
+  m4rie_check( test_io(ff, m, n) == 0); printf("."); fflush(0);
+  m4rie_check( test_file(ff, m, n) == 0); printf("."); fflush(0);
 
   if (fail_ret == 0)
     printf(" passed\n");
@@ -210,9 +658,56 @@ int main(int argc, char **argv) {
     fail_ret += test_batch(ff,  65, 129);
     fail_ret += test_batch(ff, 201, 200);
     fail_ret += test_batch(ff, 217,   2);
+    fail_ret += test_gf2e_mul_tables(ff);
+    fail_ret += test_njt_pool(ff, 70);
 
     gf2e_free(ff);
+
+    const gf2e_mode modes[] = {GF2E_MODE_ARITH, GF2E_MODE_LOGEXP};
+    for(int i=0; i<2; i++) {
+      ff = gf2e_init_mode(irreducible_polynomials[k][1], modes[i]);
+      fail_ret += test_batch(ff,  10,  11);
+      fail_ret += test_batch(ff,  65, 129);
+      gf2e_free(ff);
+    }
   }
 
+  for(int k=17; k<=32; k++) {
+    const gf2e_mode modes[] = {GF2E_MODE_AUTO, GF2E_MODE_ARITH};
+    for(int i=0; i<2; i++) {
+      ff = gf2e_init_mode(irreducible_polynomials[k][1], modes[i]);
+      fail_ret += test_batch(ff,   2,   m4ri_radix/gf2e_degree_to_w(ff));
+      fail_ret += test_batch(ff,   2, 3*m4ri_radix/gf2e_degree_to_w(ff));
+      fail_ret += test_batch(ff,   1,   2);
+      fail_ret += test_batch(ff,  10,  11);
+      fail_ret += test_batch(ff,  65, 129);
+      gf2e_free(ff);
+    }
+  }
+
+  /** every subset of kernels must give the same results **/
+  const int features[] = {0,
+                          M4RIE_CPU_SSE2,
+                          M4RIE_CPU_SSE2 | M4RIE_CPU_SSSE3,
+                          M4RIE_CPU_SSE2 | M4RIE_CPU_SSSE3 | M4RIE_CPU_AVX2,
+                          M4RIE_CPU_SSE2 | M4RIE_CPU_SSSE3 | M4RIE_CPU_AVX2 | M4RIE_CPU_GFNI,
+                          M4RIE_CPU_SSE2 | M4RIE_CPU_SSSE3 | M4RIE_CPU_AVX2 | M4RIE_CPU_AVX512 | M4RIE_CPU_GFNI};
+  for(int i=0; i<6; i++) {
+    m4rie_dispatch_init(features[i]);
+    printf("kernels: %s, %s, %s, %s, %s\n", m4rie_dispatch()->mul8_name, m4rie_dispatch()->mul16_name,
+           m4rie_dispatch()->combine_name, m4rie_dispatch()->slice8_name, m4rie_dispatch()->cling8_name);
+    for(int k=2; k<=16; k++) {
+      ff = gf2e_init(irreducible_polynomials[k][1]);
+      fail_ret += test_batch(ff,  65, 129);
+      fail_ret += test_batch(ff, 201, 200);
+      m4rie_check( test_combine(ff, 65, 513) == 0 );
+      gf2e_free(ff);
+    }
+  }
+  m4rie_dispatch_init(m4rie_cpu_features());
+
+  fail_ret += test_gf2e_registry();
+  fail_ret += test_gf2e_static_tables();
+
   return fail_ret;
 }
@@ -438,7 +438,7 @@ int test_mzd_slice_trsm_lower_left(gf2e *ff, rci_t m, rci_t n) {
 
 int test_batch(gf2e *ff, rci_t m, rci_t n) {
   int fail_ret = 0;
-  printf("trsm: k: %2d, minpoly: 0x%05x m: %5d, n: %5d ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m,(int)n);
+  printf("trsm: k: %2d, minpoly: 0x%05llx m: %5d, n: %5d ",(int)ff->degree, (unsigned long long)ff->minpoly, (int)m,(int)n);
 
   m4rie_check(test_mzed_trsm_lower_left(ff, m, n) == 0); printf("."); fflush(0);
   m4rie_check(test_mzed_trsm_upper_left(ff, m, n) == 0); printf("."); fflush(0);
@@ -485,6 +485,9 @@ int main(int argc, char **argv) {
       fail_ret += test_batch(ff, 127, 128);
       fail_ret += test_batch(ff, 200,  20);
     }
+    /** large enough for split Newton-John tables **/
+    if(k > M4RIE_NJT_SPLIT_DEGREE)
+      fail_ret += test_batch(ff, 520,  20);
     gf2e_free(ff);
   }
 
@@ -2,7 +2,7 @@
 #include <m4rie.h>
 
 #define m4rie_check(expr)						\
-  if (!expr) {								\
+  if (!(expr)) {							\
     fail_ret += 1;                                                      \
     printf("\n%s in %s:%d failed\n", #expr, __FILE__, __LINE__);  \
   } 
@@ -10,7 +10,7 @@
 const word m4rie_canary = (word)"canary!";
 
 static inline word field_mask(const gf2e *ff) {
-  const word mask_fld = ((1<<ff->degree)-1);
+  const word mask_fld = __M4RI_LEFT_BITMASK(ff->degree);
   word mask = 0;
   switch(gf2e_degree_to_w(ff)) {
   case 2:
@@ -28,6 +28,9 @@ static inline word field_mask(const gf2e *ff) {
   case 16:
     mask |= mask_fld<< 0 | mask_fld<<16 | mask_fld<<32 | mask_fld<<48;
     break;
+  case 32:
+    mask |= mask_fld<< 0 | mask_fld<<32;
+    break;
   }
   return mask;
 }